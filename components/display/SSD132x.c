@@ -339,6 +339,7 @@ struct GDS_Device* SSD132x_Detect(char *Driver, struct GDS_Device* Device) {
 		Device->DrawBitmapCBR = DrawBitmapCBR;
 		Device->ClearWindow = ClearWindow;
 		Device->Depth = 1;		
+		Device->RowFraming = true;
 		Device->Mode = GDS_MONO;
 #if !defined SHADOW_BUFFER && defined USE_IRAM	
 		Device->Alloc = GDS_ALLOC_IRAM_SPI;
@@ -13,11 +13,17 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
+#include <esp_heap_caps.h>
 #include <esp_log.h>
 
 #include "gds.h"
 #include "gds_private.h"
 
+#define PAGE_BLOCK	2048
+#define FULL_PERIOD	16
+
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+
 static char TAG[] = "SSD1675";
 
 const unsigned char EPD_lut_full_update[] = {
@@ -55,20 +61,24 @@ const unsigned char EPD_lut_partial_update[]= { //20 bytes
 struct PrivateSpace {
 	int	ReadyPin;
 	uint16_t Height;
+	uint8_t *iRAM, *Shadowbuffer;
+	// partial refreshes between full ones (0 = no partial) and how many have been done
+	uint8_t Period, Count;
+	bool PartialLUT;
 };
 
 // Functions are not declared to minimize # of lines
 
-void WaitReady( struct GDS_Device* Device) {
+void WaitReady( struct GDS_Device* Device, int Delay ) {
 	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
 	if (Private->ReadyPin >= 0) {
 		int count = 4*1000;
 		while (gpio_get_level( Private->ReadyPin ) && count) {
-			vTaskDelay( pdMS_TO_TICKS(100) );
+			vTaskDelay( pdMS_TO_TICKS(Delay < 100 ? Delay : 100) );
 			count -= 100;
 		}	
 	} else {
-		vTaskDelay( pdMS_TO_TICKS(2000) );
+		vTaskDelay( pdMS_TO_TICKS(Delay) );
 	}	
 }	
 
@@ -76,45 +86,102 @@ static void WriteByte( struct GDS_Device* Device, uint8_t Data ) {
 	Device->WriteData( Device, &Data, 1 );
 }
 
+// parameters are sent in one transaction, from DMA-capable memory
+static void WriteParams( struct GDS_Device* Device, uint8_t Command, const uint8_t *Data, size_t Len ) {
+	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
+	Device->WriteCommand( Device, Command );
+	memcpy( Private->iRAM, Data, Len );
+	Device->WriteData( Device, Private->iRAM, Len );
+}
+
 static void SetColumnAddress( struct GDS_Device* Device, uint8_t Start, uint8_t End ) {
 	// start might be greater than end if we decrement
-	Device->WriteCommand( Device, 0x44 );
-	Device->WriteData( Device, &Start, 1 );
-	Device->WriteData( Device, &End, 1 );
+	WriteParams( Device, 0x44, (uint8_t[]) { Start, End }, 2 );
 	
 	// we obviously want to start ... from the start
-	Device->WriteCommand( Device, 0x4e );	
-	WriteByte( Device, Start );
+	WriteParams( Device, 0x4e, &Start, 1 );
 }
 static void SetRowAddress( struct GDS_Device* Device, uint16_t Start, uint16_t End ) {
 	// start might be greater than end if we decrement
-	Device->WriteCommand( Device, 0x45 );	
-	WriteByte( Device, Start );
-	WriteByte( Device, Start >> 8 );
-	WriteByte( Device, End );
-	WriteByte( Device, End >> 8 );
+	WriteParams( Device, 0x45, (uint8_t[]) { Start, Start >> 8, End, End >> 8 }, 4 );
 	
 	// we obviously want to start ... from the start
-	Device->WriteCommand( Device, 0x4f );	
-	WriteByte( Device, Start );
-	WriteByte( Device, Start >> 8 );
+	WriteParams( Device, 0x4f, (uint8_t[]) { Start, Start >> 8 }, 2 );
+}
+
+/* 
+ Write pages and columns of framebuffer into one of the RAM (0x24 is new image, 0x26 is 
+ the previous one that partial LUT uses to only drive pixels that changed). RAM X is our 
+ page and RAM Y is our column, reversed (see Init)
+*/ 
+static void WriteRAM( struct GDS_Device* Device, uint8_t Command, int Page1, int Page2, int Col1, int Col2 ) {
+	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
+	int Fill = 0;
+	
+	SetColumnAddress( Device, Page1, Page2 );
+	SetRowAddress( Device, Device->Width - 1 - Col1, Device->Width - 1 - Col2 );
+	Device->WriteCommand( Device, Command );
+	
+	// panel wants 1 for white, so invert by chunks that are sent in one transaction each
+	for (int p = Page1; p <= Page2; p++) {
+		uint8_t *iptr = Device->Framebuffer + p * Device->Width + Col1;
+		for (int c = Col2 - Col1 + 1; --c >= 0;) {
+			Private->iRAM[Fill++] = ~*iptr++;
+			if (Fill == PAGE_BLOCK) {
+				Device->WriteData( Device, Private->iRAM, Fill );
+				Fill = 0;
+			}	
+		}	
+	}	
+	
+	if (Fill) Device->WriteData( Device, Private->iRAM, Fill );
 }
 
 static void Update( struct GDS_Device* Device ) {
-	uint8_t *iptr = Device->Framebuffer;
+	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
+	int Page1 = 0, Page2 = Device->Height / 8 - 1, Col1 = 0, Col2 = Device->Width - 1;
+	bool Partial = Private->Shadowbuffer && Private->Count < Private->Period;
 	
-	Device->WriteCommand( Device, 0x24 );
+	// find the window that has changed since last update
+	if (Partial) {
+		uint8_t *optr = Private->Shadowbuffer, *iptr = Device->Framebuffer;
+		Page1 = Col1 = INT16_MAX; 
+		Page2 = Col2 = -1;
+		
+		for (int p = 0; p < Device->Height / 8; p++) {
+			for (int c = 0; c < Device->Width; c++) {
+				if (*iptr++ == *optr++) continue;
+				if (Page1 == INT16_MAX) Page1 = p;
+				Page2 = p;
+				if (c < Col1) Col1 = c;
+				if (c > Col2) Col2 = c;
+			}	
+		}	
+		
+		if (Page2 < 0) return;
+	}	
 	
-	// this is awfully slow, but e-ink are slow anyway ...
-	for (int i = Device->FramebufferSize; --i >= 0;) {
-		WriteByte( Device, ~*iptr++ );
+	// each mode has its own LUT
+	if (Partial != Private->PartialLUT) {
+		WriteParams( Device, 0x32, Partial ? EPD_lut_partial_update : EPD_lut_full_update, 70 );
+		Private->PartialLUT = Partial;
 	}	
 	
+	WriteRAM( Device, 0x24, Page1, Page2, Col1, Col2 );
+	
+	// display mode 2 (differential) for partial, full sequence otherwise
 	Device->WriteCommand( Device, 0x22 ); 
-    WriteByte( Device, 0xC7);
+    WriteByte( Device, Partial ? 0xCF : 0xC7);
     Device->WriteCommand( Device, 0X20 );
 
-	WaitReady( Device );
+	WaitReady( Device, Partial ? 500 : 2000 );
+	
+	// previous image for next partial update is what we've just displayed
+	if (Private->Shadowbuffer) {
+		WriteRAM( Device, 0x26, Page1, Page2, Col1, Col2 );
+		memcpy( Private->Shadowbuffer, Device->Framebuffer, Device->FramebufferSize );
+		Private->Count = Partial ? Private->Count + 1 : 0;
+	}	
 }
 
 // remember that for these ELD drivers W and H are "inverted"
@@ -159,6 +226,17 @@ static bool Init( struct GDS_Device* Device ) {
 	Device->Framebuffer = calloc(1, Device->FramebufferSize);
 	NullCheck( Device->Framebuffer, return false );
 	
+	// bounce buffer for framebuffer chunks, LUT and parameters
+	Private->iRAM = heap_caps_malloc( PAGE_BLOCK, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA );
+	NullCheck( Private->iRAM, return false );
+	
+	// shadow is only needed to find what changed for partial refresh
+	if (Private->Period) {
+		Private->Shadowbuffer = malloc( Device->FramebufferSize );
+		NullCheck( Private->Shadowbuffer, return false );
+		Private->Count = Private->Period;
+	}	
+	
 	if (Private->ReadyPin >= 0) {
 		gpio_pad_select_gpio( Private->ReadyPin );
 		gpio_set_pull_mode( Private->ReadyPin, GPIO_PULLUP_ONLY);
@@ -168,7 +246,7 @@ static bool Init( struct GDS_Device* Device ) {
 	// soft reset	
 	vTaskDelay(pdMS_TO_TICKS( 2000 ));
     Device->WriteCommand( Device, 0x12 ); 	
-	WaitReady( Device );
+	WaitReady( Device, 2000 );
 	
 	Device->WriteCommand( Device, 0x74 ); 			
     WriteByte( Device, 0x54 );
@@ -184,26 +262,17 @@ static bool Init( struct GDS_Device* Device ) {
 	Device->WriteCommand( Device, 0x03 );	
 	WriteByte( Device, EPD_lut_full_update[70] );
 	
-	Device->WriteCommand( Device, 0x04 );	
-	WriteByte( Device, EPD_lut_full_update[71] );
-	WriteByte( Device, EPD_lut_full_update[72] );
-	WriteByte( Device, EPD_lut_full_update[73] );
+	WriteParams( Device, 0x04, EPD_lut_full_update + 71, 3 );
 	
 	Device->WriteCommand( Device, 0x3a );	
 	WriteByte( Device, EPD_lut_full_update[74] );
 	Device->WriteCommand( Device, 0x3b );	
 	WriteByte( Device, EPD_lut_full_update[75] );
 	
-	Device->WriteCommand( Device, 0X32 );	
-	for (int i = 0; i < 70; i++) {
-		WriteByte( Device, EPD_lut_full_update[i] );
-	}	
+	WriteParams( Device, 0x32, EPD_lut_full_update, 70 );
 
 	// now deal with funny X/Y layout (W and H are "inverted")
-	Device->WriteCommand( Device, 0x01 );
-    WriteByte( Device, Device->Width - 1 );
-    WriteByte( Device, (Device->Width - 1) >> 8 );
-    WriteByte( Device, (0 << 0) );		
+	WriteParams( Device, 0x01, (uint8_t[]) { Device->Width - 1, (Device->Width - 1) >> 8, (0 << 0) }, 3 );
 
 	/* 
 	 Start from 0, Ymax, incX, decY. Starting from X=Height would be difficult
@@ -215,11 +284,7 @@ static bool Init( struct GDS_Device* Device ) {
 	Device->WriteCommand( Device, 0x11 ); 			
 	WriteByte( Device, (1 << 2) | (0 << 1) | (1 << 0));
 		
-	// must be in order with increment/decrement i.e start might be > end if we decrement
-	SetColumnAddress( Device, 0x0, (Device->Height >> 3) - 1 );
-	SetRowAddress ( Device, Device->Width - 1, 0 );
-
-	WaitReady( Device );
+	WaitReady( Device, 2000 );
 	
 	Update( Device );
 	
@@ -230,7 +295,7 @@ static const struct GDS_Device SSD1675 = {
 	.DrawBitmapCBR = DrawBitmapCBR, .ClearWindow = ClearWindow,
 	.DrawPixelFast = _DrawPixel,
 	.Update = Update, .Init = Init,
-	.Mode = GDS_MONO, .Depth = 1,
+	.Mode = GDS_MONO, .Depth = 1, .MSBFirst = true,
 	.Alloc = GDS_ALLOC_NONE,
 };	
 
@@ -244,8 +309,10 @@ struct GDS_Device* SSD1675_Detect(char *Driver, struct GDS_Device* Device) {
 	struct PrivateSpace* Private = (struct PrivateSpace*) Device->Private;
 	Private->ReadyPin = -1;
 	if ((p = strcasestr(Driver, "ready")) != NULL) Private->ReadyPin = atoi(strchr(p, '=') + 1);
+	// partial[=N] means N partial refreshes between full ones (that clear ghosting)
+	if ((p = strcasestr(Driver, "partial")) != NULL) Private->Period = p[7] == '=' ? atoi(p + 8) : FULL_PERIOD;
 	
-	ESP_LOGI(TAG, "SSD1675 driver with ready GPIO %d", Private->ReadyPin);
+	ESP_LOGI(TAG, "SSD1675 driver with ready GPIO %d, partial refresh %u", Private->ReadyPin, Private->Period);
 	
 	return Device;
 }
\ No newline at end of file
@@ -58,12 +58,16 @@ static void Update16( struct GDS_Device* Device ) {
 	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
 		
 #ifdef SHADOW_BUFFER
-	uint32_t *optr = (uint32_t*) Private->Shadowbuffer, *iptr = (uint32_t*) Device->Framebuffer;
+	int Left = Device->Damage.Left / 2, Right = (Device->Damage.Right + 1) / 2;
 	int FirstCol = Device->Width / 2, LastCol = 0, FirstRow = -1, LastRow = 0;  
 	
-	for (int r = 0; r < Device->Height; r++) {
+	// only scan what has been damaged
+	for (int r = Device->Damage.Top; r < Device->Damage.Bottom; r++) {
+		uint32_t *optr = (uint32_t*) Private->Shadowbuffer + r * Device->Width / 2 + Left;
+		uint32_t *iptr = (uint32_t*) Device->Framebuffer + r * Device->Width / 2 + Left;
+		
 		// look for change and update shadow (cheap optimization = width is always a multiple of 2)
-		for (int c = 0; c < Device->Width / 2; c++, iptr++, optr++) {
+		for (int c = Left; c < Right; c++, iptr++, optr++) {
 			if (*optr != *iptr) {
 				*optr = *iptr;
 				if (c < FirstCol) FirstCol = c;	
@@ -74,7 +78,7 @@ static void Update16( struct GDS_Device* Device ) {
 		}
 
 		// wait for a large enough window - careful that window size might increase by more than a line at once !
-		if (FirstRow < 0 || ((LastCol - FirstCol + 1) * (r - FirstRow + 1) * 4 < PAGE_BLOCK && r != Device->Height - 1)) continue;
+		if (FirstRow < 0 || ((LastCol - FirstCol + 1) * (r - FirstRow + 1) * 4 < PAGE_BLOCK && r != Device->Damage.Bottom - 1)) continue;
 		
 		FirstCol *= 2;
 		LastCol = LastCol * 2 + 1;
@@ -102,11 +106,11 @@ static void Update16( struct GDS_Device* Device ) {
 		FirstRow = -1;
 	}	
 #else
-	// always update by full lines
+	// always update by full lines, but only damaged ones
 	SetColumnAddress( Device, Private->Offset.Width, Device->Width - 1);
 	
-	for (int r = 0; r < Device->Height; r += min(Private->PageSize, Device->Height - r)) {
-		int Height = min(Private->PageSize, Device->Height - r);
+	for (int r = Device->Damage.Top; r < Device->Damage.Bottom; r += min(Private->PageSize, Device->Damage.Bottom - r)) {
+		int Height = min(Private->PageSize, Device->Damage.Bottom - r);
 		
 		SetRowAddress( Device, Private->Offset.Height + r, Private->Offset.Height + r + Height - 1 );
 		Device->WriteCommand(Device, ENABLE_WRITE);
@@ -125,12 +129,16 @@ static void Update24( struct GDS_Device* Device ) {
 	struct PrivateSpace *Private = (struct PrivateSpace*) Device->Private;
 		
 #ifdef SHADOW_BUFFER
-	uint16_t *optr = (uint16_t*) Private->Shadowbuffer, *iptr = (uint16_t*) Device->Framebuffer;
+	int Left = (Device->Damage.Left * 3) / 2, Right = (Device->Damage.Right * 3 + 1) / 2;
 	int FirstCol = (Device->Width * 3) / 2, LastCol = 0, FirstRow = -1, LastRow = 0;  
 	
-	for (int r = 0; r < Device->Height; r++) {
+	// only scan what has been damaged
+	for (int r = Device->Damage.Top; r < Device->Damage.Bottom; r++) {
+		uint16_t *optr = (uint16_t*) Private->Shadowbuffer + (r * Device->Width * 3) / 2 + Left;
+		uint16_t *iptr = (uint16_t*) Device->Framebuffer + (r * Device->Width * 3) / 2 + Left;
+		
 		// look for change and update shadow (cheap optimization = width always / by 2)
-		for (int c = 0; c < (Device->Width * 3) / 2; c++, optr++, iptr++) {
+		for (int c = Left; c < Right; c++, optr++, iptr++) {
 			if (*optr != *iptr) {
 				*optr = *iptr;
 				if (c < FirstCol) FirstCol = c;	
@@ -141,7 +149,7 @@ static void Update24( struct GDS_Device* Device ) {
 		}
 		
 		// do we have enough to send (cols are divided by 3/2)
-		if (FirstRow < 0 || ((((LastCol - FirstCol + 1) * 2 + 3 - 1) / 3) * (r - FirstRow + 1) * 3 < PAGE_BLOCK && r != Device->Height - 1)) continue;
+		if (FirstRow < 0 || ((((LastCol - FirstCol + 1) * 2 + 3 - 1) / 3) * (r - FirstRow + 1) * 3 < PAGE_BLOCK && r != Device->Damage.Bottom - 1)) continue;
 		
 		FirstCol = (FirstCol * 2) / 3;
 		LastCol = (LastCol * 2 + 1) / 3; 
@@ -169,11 +177,11 @@ static void Update24( struct GDS_Device* Device ) {
 		FirstRow = -1;
 	}	
 #else
-	// always update by full lines
+	// always update by full lines, but only damaged ones
 	SetColumnAddress( Device, Private->Offset.Width, Device->Width - 1);
 	
-	for (int r = 0; r < Device->Height; r += min(Private->PageSize, Device->Height - r)) {
-		int Height = min(Private->PageSize, Device->Height - r);
+	for (int r = Device->Damage.Top; r < Device->Damage.Bottom; r += min(Private->PageSize, Device->Damage.Bottom - r)) {
+		int Height = min(Private->PageSize, Device->Damage.Bottom - r);
 		
 		SetRowAddress( Device, Private->Offset.Height + r, Private->Offset.Height + r + Height - 1 );
 		Device->WriteCommand(Device, ENABLE_WRITE);
@@ -268,7 +276,7 @@ static const struct GDS_Device ST77xx = {
 	.DisplayOn = DisplayOn, .DisplayOff = DisplayOff,
 	.SetLayout = SetLayout,
 	.Update = Update16, .Init = Init,
-	.Mode = GDS_RGB565, .Depth = 16,
+	.Mode = GDS_RGB565, .Depth = 16, .HWRotate = true,
 };		
 
 struct GDS_Device* ST77xx_Detect(char *Driver, struct GDS_Device* Device) {
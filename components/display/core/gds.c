@@ -76,10 +76,10 @@ void GDS_Clear( struct GDS_Device* Device, int Color ) {
 	Device->Dirty = true;
 }
 
-#define CLEAR_WINDOW(x1,y1,x2,y2,F,W,C,T,N)				\
+#define CLEAR_WINDOW(x1,y1,x2,y2,F,W,C,T)				\
 	for (int y = y1; y <= y2; y++) {					\
-		T *Ptr = (T*) F + (y * W + x1)*N;				\
-		for (int c = (x2 - x1)*N; c-- >= 0; *Ptr++ = C);	\
+		T *Ptr = (T*) F + y * W + x1;					\
+		for (int c = x2 - x1; c-- >= 0; *Ptr++ = C);	\
 	}
 
 void GDS_ClearWindow( struct GDS_Device* Device, int x1, int y1, int x2, int y2, int Color ) {
@@ -116,7 +116,7 @@ void GDS_ClearWindow( struct GDS_Device* Device, int x1, int y1, int x2, int y2,
 				}
 			}
 		}
-	} if (Device->Depth == 4) {
+	} else if (Device->Depth == 4) {
 		if (x2 - x1 == Device->Width - 1 && y2 - y1 == Device->Height - 1) {
 			// we assume color is 0..15
 			memset( Device->Framebuffer, Color | (Color << 4), Device->FramebufferSize );
@@ -134,11 +134,19 @@ void GDS_ClearWindow( struct GDS_Device* Device, int x1, int y1, int x2, int y2,
 			}
 		}	
 	} else if (Device->Depth == 8) {
-		CLEAR_WINDOW(x1,y1,x2,y2,Device->Framebuffer,Device->Width,Color,uint8_t,1);
+		CLEAR_WINDOW(x1,y1,x2,y2,Device->Framebuffer,Device->Width,Color,uint8_t);
 	} else if (Device->Depth == 16) {
-		CLEAR_WINDOW(x1,y1,x2,y2,Device->Framebuffer,Device->Width,Color,uint16_t,1);
+		// same byte order as DrawPixel16Fast
+		uint16_t _Color = __builtin_bswap16(Color);
+		CLEAR_WINDOW(x1,y1,x2,y2,Device->Framebuffer,Device->Width,_Color,uint16_t);
 	} else if (Device->Depth == 24) {
-		CLEAR_WINDOW(x1,y1,x2,y2,Device->Framebuffer,Device->Width,Color,uint8_t,3);
+		// same serialization as DrawPixel18Fast/DrawPixel24Fast, 3 bytes per pixel
+		uint8_t R = Color >> 16, G = Color >> 8, B = Color;
+		if (Device->Mode == GDS_RGB666) { R = Color >> 12; G = (Color >> 6) & 0x3f; B = Color & 0x3f; }
+		for (int y = y1; y <= y2; y++) {
+			uint8_t *Ptr = Device->Framebuffer + (y * Device->Width + x1) * 3;
+			for (int c = x2 - x1; c-- >= 0;) { *Ptr++ = R; *Ptr++ = G; *Ptr++ = B; }
+		}
 	} else {
 		for (int y = y1; y <= y2; y++) {
 			for (int x = x1; x <= x2; x++) {
@@ -151,9 +159,194 @@ void GDS_ClearWindow( struct GDS_Device* Device, int x1, int y1, int x2, int y2,
 	Device->Dirty = true;
 }
 
+/****************************************************************************************
+ * Software rotation. Drawing is done in a framebuffer of the same layout where Width and 
+ * Height are swapped and damaged area is transposed by 8x8 blocks into the physical one, 
+ * so that both sides are read/written in small cache-friendly chunks. Rotation only 
+ * exchanges rows and columns (like MADCTL's MV bit), so with HFlip it's a clockwise 90° 
+ * and with VFlip a counter-clockwise one (270°)
+ */
+ 
+static uint32_t FramebufferSize( struct GDS_Device* Device, int Width, int Height ) {
+	if (Device->Depth == 1 && Device->RowFraming) return (Width + 7) / 8 * Height;
+	else if (Device->Depth == 1) return Width * ((Height + 7) / 8);
+	else if (Device->Depth == 4) return (Width + 1) / 2 * Height;
+	else return Width * Height * (Device->Depth / 8);
+}
+
+// byte i of input is row i, returns byte i = column i (bit j of byte i is bit i of byte j)
+static inline uint64_t Transpose8x8( uint64_t x ) {
+	uint64_t t;
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL; x ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL; x ^= t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL; x ^= t ^ (t << 28);
+	return x;
+}
+
+static void Transpose( struct GDS_Device* Device ) {
+	// logical is what we draw, physical is what driver sends (its Width is our Height)
+	int Width = Device->Width, Height = Device->Height;
+	uint8_t *Logical = Device->Framebuffer, *Physical = Device->Rotation.Framebuffer;
+	int Left = Device->Damage.Left & ~7, Top = Device->Damage.Top & ~7;
+	
+	for (int y = Top; y < Device->Damage.Bottom; y += 8) {
+		int Rows = Height - y < 8 ? Height - y : 8;
+		
+		for (int x = Left; x < Device->Damage.Right; x += 8) {
+			int Cols = Width - x < 8 ? Width - x : 8;
+				
+			if (Device->Depth == 1) {
+				uint8_t *iptr, *optr;
+				int Step, In, Out;
+				uint64_t Block = 0;
+				
+				// a block is 8 bytes either way, we just need to know where they are
+				if (Device->RowFraming) {
+					iptr = Logical + y * ((Width + 7) / 8) + x / 8;
+					optr = Physical + x * ((Height + 7) / 8) + y / 8;
+					Step = (Width + 7) / 8; In = Rows; 
+					Out = Cols;
+				} else {
+					iptr = Logical + (y / 8) * Width + x;
+					optr = Physical + (x / 8) * Height + y;
+					Step = 1; In = Cols; 
+					Out = Rows;
+				}	
+					
+				for (int i = 0; i < In; i++, iptr += Step) Block |= (uint64_t) *iptr << (i * 8);
+				
+				// when MSB comes first, pixel order is reversed on both axis
+				if (Device->MSBFirst) Block = __builtin_bswap64(Transpose8x8(__builtin_bswap64(Block)));
+				else Block = Transpose8x8(Block);
+				
+				Step = Device->RowFraming ? (Height + 7) / 8 : 1;
+				for (int i = 0; i < Out; i++, optr += Step) *optr = Block >> (i * 8);
+			} else if (Device->Depth == 4) {
+				// odd pixels are the high nibble, SetRotation makes sure width and height are even
+				for (int c = x; c < x + Cols; c++) {
+					uint8_t *optr = Physical + (c * Height + y) / 2;
+					int Shift = (c & 0x01) << 2;
+					for (int r = y; r < y + Rows; r += 2) {
+						*optr++ = ((Logical[(r * Width + c) / 2] >> Shift) & 0x0f) | 
+								  (((Logical[((r + 1) * Width + c) / 2] >> Shift) & 0x0f) << 4);
+					}	
+				}	
+			} else if (Device->Depth == 8) {
+				for (int c = x; c < x + Cols; c++) {
+					uint8_t *optr = Physical + c * Height + y, *iptr = Logical + y * Width + c;
+					for (int r = Rows; --r >= 0; iptr += Width) *optr++ = *iptr;
+				}	
+			} else if (Device->Depth == 16) {
+				for (int c = x; c < x + Cols; c++) {
+					uint16_t *optr = (uint16_t*) Physical + c * Height + y, *iptr = (uint16_t*) Logical + y * Width + c;
+					for (int r = Rows; --r >= 0; iptr += Width) *optr++ = *iptr;
+				}	
+			} else {
+				for (int c = x; c < x + Cols; c++) {
+					uint8_t *optr = Physical + (c * Height + y) * 3, *iptr = Logical + (y * Width + c) * 3;
+					for (int r = Rows; --r >= 0; iptr += Width * 3) {
+						*optr++ = iptr[0]; *optr++ = iptr[1]; *optr++ = iptr[2];
+					}	
+				}	
+			}	
+		}	
+	}	
+}
+
+// exchange logical and physical sides (framebuffer, size, dimensions and damage)
+static void SwapRotation( struct GDS_Device* Device ) {
+	uint8_t *Framebuffer = Device->Framebuffer;
+	uint32_t Size = Device->FramebufferSize;
+	int16_t Left = Device->Damage.Left, Right = Device->Damage.Right;
+	uint16_t Width = Device->Width;
+	
+	Device->Framebuffer = Device->Rotation.Framebuffer;
+	Device->FramebufferSize = Device->Rotation.FramebufferSize;
+	Device->Rotation.Framebuffer = Framebuffer;
+	Device->Rotation.FramebufferSize = Size;
+	
+	Device->Width = Device->Height;
+	Device->Height = Width;
+	
+	Device->Damage.Left = Device->Damage.Top;
+	Device->Damage.Right = Device->Damage.Bottom;
+	Device->Damage.Top = Left;
+	Device->Damage.Bottom = Right;
+}
+
+static bool SetRotation( struct GDS_Device* Device, bool Rotate ) {
+	if (Rotate == Device->Rotation.Active) return true;
+	
+	if (Rotate) {
+		// 4 bits pixels are transposed by pairs of rows and columns
+		if (Device->Depth == 4 && ((Device->Width | Device->Height) & 0x01)) {
+			ESP_LOGE(TAG, "software rotation needs even width and height (%ux%u)", Device->Width, Device->Height);
+			return false;
+		}
+		
+		// physical buffer (driver's) is kept aside and we draw in a new one
+		uint32_t Size = FramebufferSize( Device, Device->Height, Device->Width );
+		uint8_t *Framebuffer = calloc( 1, Size );
+		NullCheck( Framebuffer, return false );
+		Device->Rotation.Framebuffer = Framebuffer;
+		Device->Rotation.FramebufferSize = Size;
+		SwapRotation( Device );
+	} else {
+		SwapRotation( Device );
+		free( Device->Rotation.Framebuffer );
+		Device->Rotation.Framebuffer = NULL;
+	}	
+	
+	Device->Rotation.Active = Rotate;
+	Device->Damage.Left = Device->Damage.Right = 0;
+	Device->Dirty = true;
+	
+	ESP_LOGI(TAG, "software rotation %s (%ux%u)", Rotate ? "on" : "off", Device->Width, Device->Height);
+	return true;
+}
+
 void GDS_Update( struct GDS_Device* Device ) {
-	if (Device->Dirty) Device->Update( Device );
+	// anything drawn without invalidating its area means whole screen
+	if (Device->Dirty) {
+		Device->Damage.Left = Device->Damage.Top = 0;
+		Device->Damage.Right = Device->Width;
+		Device->Damage.Bottom = Device->Height;
+	}	
+	
+	if (Device->Damage.Right > Device->Damage.Left) {
+		if (Device->Rotation.Active) {
+			Transpose( Device );
+			SwapRotation( Device );
+			Device->Update( Device );
+			SwapRotation( Device );
+		} else {
+			Device->Update( Device );
+		}	
+	}	
+	
 	Device->Dirty = false;
+	Device->Damage.Left = Device->Damage.Right = 0;
+}
+
+// only that area has changed, drivers that can will limit update to it
+void GDS_Invalidate( struct GDS_Device* Device, int x1, int y1, int x2, int y2 ) {
+	if (x1 < 0) x1 = 0;
+	if (y1 < 0) y1 = 0;
+	if (++x2 > Device->Width) x2 = Device->Width;
+	if (++y2 > Device->Height) y2 = Device->Height;
+	if (x1 >= x2 || y1 >= y2) return;
+	
+	if (Device->Damage.Right <= Device->Damage.Left) {
+		Device->Damage.Left = x1;
+		Device->Damage.Top = y1;
+		Device->Damage.Right = x2;
+		Device->Damage.Bottom = y2;
+	} else {
+		if (x1 < Device->Damage.Left) Device->Damage.Left = x1;
+		if (y1 < Device->Damage.Top) Device->Damage.Top = y1;
+		if (x2 > Device->Damage.Right) Device->Damage.Right = x2;
+		if (y2 > Device->Damage.Bottom) Device->Damage.Bottom = y2;
+	}	
 }
 
 bool GDS_Reset( struct GDS_Device* Device ) {
@@ -236,7 +429,11 @@ void GDS_SetContrast( struct GDS_Device* Device, uint8_t Contrast ) {
 	}
 }
 	
-void GDS_SetLayout( struct GDS_Device* Device, bool HFlip, bool VFlip, bool Rotate ) { if (Device->SetLayout) Device->SetLayout( Device, HFlip, VFlip, Rotate ); }
+void GDS_SetLayout( struct GDS_Device* Device, bool HFlip, bool VFlip, bool Rotate ) { 
+	// drivers that can't rotate still do flips, we do the row/column exchange
+	if (!Device->HWRotate && SetRotation( Device, Rotate )) Rotate = false;
+	if (Device->SetLayout) Device->SetLayout( Device, HFlip, VFlip, Rotate ); 
+}	
 void GDS_SetDirty( struct GDS_Device* Device ) { Device->Dirty = true; }
 int	GDS_GetWidth( struct GDS_Device* Device ) { return Device->Width; }
 int	GDS_GetHeight( struct GDS_Device* Device ) { return Device->Height; }
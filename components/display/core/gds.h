@@ -35,8 +35,11 @@ void 	GDS_SetContrast( struct GDS_Device* Device, uint8_t Contrast );
 void 	GDS_DisplayOn( struct GDS_Device* Device );
 void 	GDS_DisplayOff( struct GDS_Device* Device ); 
 void 	GDS_Update( struct GDS_Device* Device );
+// Rotate exchanges rows and columns, use HFlip for 90° and VFlip for 270°. When driver can't 
+// do it, it's done in software and Width/Height (GDS_GetWidth/Height) are swapped
 void 	GDS_SetLayout( struct GDS_Device* Device, bool HFlip, bool VFlip, bool Rotate );
 void 	GDS_SetDirty( struct GDS_Device* Device );
+void 	GDS_Invalidate( struct GDS_Device* Device, int x1, int y1, int x2, int y2 );
 int 	GDS_GetWidth( struct GDS_Device* Device );
 int 	GDS_GetHeight( struct GDS_Device* Device );
 int 	GDS_GetDepth( struct GDS_Device* Device );
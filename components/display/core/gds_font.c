@@ -6,9 +6,18 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <math.h>
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "gds_private.h"
 #include "gds.h"
 #include "gds_font.h"
@@ -25,8 +34,190 @@ static int RoundUpFontHeight( const struct GDS_FontDef* Font ) {
     return Height;
 }
 
+static int GetColumnLen( const struct GDS_FontDef* Font ) {
+    return ( Font->Depth == 4 ) ? ( Font->Height + 1 ) / 2 : RoundUpFontHeight( Font ) / 8;
+}
+
 static const uint8_t* GetCharPtr( const struct GDS_FontDef* Font, char Character ) {
-    return &Font->FontData[ ( Character - Font->StartChar ) * ( ( Font->Width * ( RoundUpFontHeight( Font ) / 8 ) ) + 1 ) ];
+    return &Font->FontData[ ( Character - Font->StartChar ) * ( ( Font->Width * GetColumnLen( Font ) ) + 1 ) ];
+}
+
+static int GetCharWidth( struct GDS_Device* Display, char Character ) {
+    const uint8_t* CharPtr = NULL;
+    int Width = 0;
+
+    if ( Character >= Display->Font->StartChar && Character <= Display->Font->EndChar ) {
+        CharPtr = GetCharPtr( Display->Font, Character );
+
+        Width = ( Display->Font->Monospace == true ) ? Display->Font->Width : *CharPtr;
+
+        if ( Display->FontForceMonospace == true ) {
+            Width = Display->Font->Width;
+        }
+
+        if ( Display->FontForceProportional == true ) {
+            Width = *CharPtr;
+        }
+    }
+
+    return Width;
+}
+
+static inline int GetScale( struct GDS_Device* Display ) {
+    return Display->FontScale > 1 ? Display->FontScale : 1;
+}
+
+/****************************************************************************************
+ * Scaled glyphs are made of rectangles: each column is split in runs of set bits, each
+ * run becoming a single span fill. Identical consecutive columns are merged so that
+ * 7-segments and bold glyphs are mostly drawn as a handful of large rectangles.
+ */
+static void FillClipped( struct GDS_Device* Device, int x1, int y1, int x2, int y2, int Color ) {
+	if (x1 < 0) x1 = 0;
+	if (y1 < 0) y1 = 0;
+	if (x2 >= Device->Width) x2 = Device->Width - 1;
+	if (y2 >= Device->Height) y2 = Device->Height - 1;
+	if (x1 > x2 || y1 > y2) return;
+	
+	// ClearWindow can't XOR, so do it pixel by pixel
+	if (Color == GDS_COLOR_XOR) {
+		for (int r = y1; r <= y2; r++) for (int c = x1; c <= x2; c++) DrawPixelFast( Device, c, r, Color );
+		Device->Dirty = true;
+	} else {
+		GDS_ClearWindow( Device, x1, y1, x2, y2, Color );
+	}	
+}
+
+static void DrawCharScaled( struct GDS_Device* Device, char Character, int x, int y, int Color, int Scale ) {
+	const uint8_t* GlyphData = GetCharPtr( Device->Font, Character ) + 1;
+	int GlyphColumnLen = RoundUpFontHeight( Device->Font ) / 8;
+	int CharWidth = GetCharWidth( Device, Character );
+	int CharHeight = Device->Font->Height;
+
+	if ( x + CharWidth * Scale <= 0 || x >= Device->Width || y + CharHeight * Scale <= 0 || y >= Device->Height ) {
+		ClipDebug( x, y );
+		return;
+	}
+
+	for ( int Column = 0, Span; Column < CharWidth; Column += Span, GlyphData += Span * GlyphColumnLen ) {
+		int x1 = x + Column * Scale;
+
+		for ( Span = 1; Column + Span < CharWidth && !memcmp( GlyphData, GlyphData + Span * GlyphColumnLen, GlyphColumnLen ); Span++ );
+
+		for ( int Line = 0; Line < CharHeight; ) {
+			int Start;
+
+			// skip empty bytes at once
+			if ( !( Line & 0x07 ) && !GlyphData[Line >> 3] ) {
+				Line += 8;
+				continue;
+			}
+
+			if ( !( GlyphData[Line >> 3] & BIT( Line & 0x07 ) ) ) {
+				Line++;
+				continue;
+			}
+
+			for ( Start = Line; Line < CharHeight && ( GlyphData[Line >> 3] & BIT( Line & 0x07 ) ); Line++ );
+			FillClipped( Device, x1, y + Start * Scale, x1 + Span * Scale - 1, y + Line * Scale - 1, Color );
+		}
+	}
+}
+
+/****************************************************************************************
+ * 4 bits antialiased glyphs are blended using a 16 entries LUT computed once for a given
+ * (foreground, background, mode) so drawing only does lookups and writes, directly in
+ * the framebuffer for 4, 8, 16 and 24 bits depth. A nul alpha leaves pixel untouched.
+ */
+static const struct {
+	uint8_t Shift[3], Bits[3];
+} Channels[] = {
+	[GDS_RGB332] = { { 5, 2, 0 }, { 3, 3, 2 } },
+	[GDS_RGB444] = { { 8, 4, 0 }, { 4, 4, 4 } },
+	[GDS_RGB555] = { { 10, 5, 0 }, { 5, 5, 5 } },
+	[GDS_RGB565] = { { 11, 5, 0 }, { 5, 6, 5 } },
+	[GDS_RGB666] = { { 12, 6, 0 }, { 6, 6, 6 } },
+	[GDS_RGB888] = { { 16, 8, 0 }, { 8, 8, 8 } },
+};
+
+static struct {
+	int Color, Background;
+	uint8_t Mode, Depth;
+	bool Valid;
+	int Lut[16];
+	uint16_t Lut16[16];
+} Blend;
+
+static void SetBlendLut( struct GDS_Device* Device, int Color, int Background ) {
+	if (Blend.Valid && Blend.Color == Color && Blend.Background == Background && 
+		Blend.Mode == Device->Mode && Blend.Depth == Device->Depth) return;
+
+	for (int Alpha = 0; Alpha < 16; Alpha++) {
+		int Value = 0;
+		
+		if (Device->Mode <= GDS_GRAYSCALE) {
+			int Mask = (1 << Device->Depth) - 1, F = Color & Mask, B = Background & Mask;
+			Value = (B * (15 - Alpha) + F * Alpha + 7) / 15;
+		} else for (int i = 0; i < 3; i++) {
+			int Mask = (1 << Channels[Device->Mode].Bits[i]) - 1, Shift = Channels[Device->Mode].Shift[i];
+			int F = (Color >> Shift) & Mask, B = (Background >> Shift) & Mask;
+			Value |= ((B * (15 - Alpha) + F * Alpha + 7) / 15) << Shift;
+		}
+		
+		Blend.Lut[Alpha] = Value;
+		Blend.Lut16[Alpha] = __builtin_bswap16(Value);
+	}
+
+	Blend.Color = Color;
+	Blend.Background = Background;
+	Blend.Mode = Device->Mode;
+	Blend.Depth = Device->Depth;
+	Blend.Valid = true;
+}
+
+#define DRAW_GLYPH4(W)														\
+	for ( int c = FirstCol; c < LastCol; c++ ) {							\
+		const uint8_t *Data = GlyphData + c * GlyphColumnLen;				\
+		for ( int l = FirstLine, X = x + c; l < LastLine; l++ ) {			\
+			int Alpha = ( Data[l >> 1] >> ( ( l & 0x01 ) << 2 ) ) & 0x0f;	\
+			int Y = y + l;													\
+			if ( Alpha ) { W; }												\
+		}																	\
+	}
+
+static void DrawChar4( struct GDS_Device* Device, char Character, int x, int y, int Color ) {
+	const uint8_t* GlyphData = GetCharPtr( Device->Font, Character ) + 1;
+	int GlyphColumnLen = GetColumnLen( Device->Font );
+	int CharWidth = GetCharWidth( Device, Character );
+	int CharHeight = Device->Font->Height;
+	int FirstCol = ( x < 0 ) ? -x : 0, LastCol = ( x + CharWidth > Device->Width ) ? Device->Width - x : CharWidth;
+	int FirstLine = ( y < 0 ) ? -y : 0, LastLine = ( y + CharHeight > Device->Height ) ? Device->Height - y : CharHeight;
+
+	if ( FirstCol >= LastCol || FirstLine >= LastLine ) {
+		ClipDebug( x, y );
+		return;
+	}
+
+	Device->Dirty = true;
+	SetBlendLut( Device, Color, Device->FontBackground );
+
+	if ( Device->Depth == 1 ) {
+		DRAW_GLYPH4( if ( Alpha & 0x08 ) DrawPixelFast( Device, X, Y, Color ) );
+	} else if ( Device->DrawPixelFast ) {
+		DRAW_GLYPH4( DrawPixelFast( Device, X, Y, Blend.Lut[Alpha] ) );
+	} else if ( Device->Depth == 4 ) {
+		int LineLen = Device->Width >> 1;
+		DRAW_GLYPH4( uint8_t *FBOffset = Device->Framebuffer + Y * LineLen + ( X >> 1 );
+					 *FBOffset = ( X & 0x01 ) ? ( *FBOffset & 0x0f ) | ( Blend.Lut[Alpha] << 4 ) : ( *FBOffset & 0xf0 ) | Blend.Lut[Alpha] );
+	} else if ( Device->Depth == 8 ) {
+		DRAW_GLYPH4( Device->Framebuffer[Y * Device->Width + X] = Blend.Lut[Alpha] );
+	} else if ( Device->Depth == 16 ) {
+		DRAW_GLYPH4( ( (uint16_t*) Device->Framebuffer )[Y * Device->Width + X] = Blend.Lut16[Alpha] );
+	} else if ( Device->Depth == 24 && Device->Mode == GDS_RGB666 ) {
+		DRAW_GLYPH4( DrawPixel18Fast( Device, X, Y, Blend.Lut[Alpha] ) );
+	} else if ( Device->Depth == 24 ) {
+		DRAW_GLYPH4( DrawPixel24Fast( Device, X, Y, Blend.Lut[Alpha] ) );
+	}
 }
 
 void GDS_FontDrawChar( struct GDS_Device* Device, char Character, int x, int y, int Color ) {
@@ -46,13 +237,26 @@ void GDS_FontDrawChar( struct GDS_Device* Device, char Character, int x, int y,
 
     NullCheck( ( GlyphData = GetCharPtr( Device->Font, Character ) ), return );
 
+    if ( Character < Device->Font->StartChar || Character > Device->Font->EndChar ) return;
+    
+    if ( Device->Font->Depth == 4 ) {
+        CheckBounds( GetScale( Device ) > 1, return );
+        DrawChar4( Device, Character, x, y, Color );
+        return;
+    }
+
+    if ( GetScale( Device ) > 1 ) {
+        DrawCharScaled( Device, Character, x, y, Color, GetScale( Device ) );
+        return;
+    }
+
     if ( Character >= Device->Font->StartChar && Character <= Device->Font->EndChar ) {
         /* The first byte in the glyph data is the width of the character in pixels, skip over */
         GlyphData++;
         GlyphColumnLen = RoundUpFontHeight( Device->Font ) / 8;
         
-        CharWidth = GDS_FontGetCharWidth( Device, Character );
-        CharHeight = GDS_FontGetHeight( Device );
+        CharWidth = GetCharWidth( Device, Character );
+        CharHeight = Device->Font->Height;
 
         CharStartX = x;
         CharStartY = y;
@@ -98,9 +302,131 @@ void GDS_FontDrawChar( struct GDS_Device* Device, char Character, int x, int y,
     }
 }
 
+/****************************************************************************************
+ * X-GLCD glyphs are stored by columns, so once rotated by 90 or 270 degrees, a glyph
+ * column becomes a framebuffer row. Each glyph byte is written as a run of 8 pixels
+ * where bit 0 is the leftmost one, so empty bytes are skipped at once and rows are
+ * directly written for 4, 8, 16 and 24 bits and for 1 bit row-framed (SSD1326) screens.
+ */
+static inline uint8_t ReverseByte( uint8_t Byte ) {
+	return ((Byte * 0x0802LU & 0x22110LU) | (Byte * 0x8020LU & 0x88440LU)) * 0x10101LU >> 16;
+}
+
+static void DrawRowBits( struct GDS_Device* Device, int X, int Y, uint8_t Bits, int Color ) {
+	if (Device->Depth == 1 && Device->RowFraming) {
+		// bits may straddle two bytes but the ones out of the screen have been masked
+		int Offset = Y * Device->Width + X, Shift = X & 0x07;
+		uint8_t Lo = Bits << Shift, Hi = (Bits << Shift) >> 8;
+		uint8_t *FBOffset = Device->Framebuffer + (Offset >> 3);
+
+		if (Color == GDS_COLOR_XOR) {
+			if (Lo) FBOffset[0] ^= Lo;
+			if (Hi) FBOffset[1] ^= Hi;
+		} else if (Color == GDS_COLOR_BLACK) {
+			if (Lo) FBOffset[0] &= ~Lo;
+			if (Hi) FBOffset[1] &= ~Hi;
+		} else {
+			if (Lo) FBOffset[0] |= Lo;
+			if (Hi) FBOffset[1] |= Hi;
+		}
+	} else if (Device->DrawPixelFast || Device->Depth == 1) {
+		for (; Bits; Bits >>= 1, X++) if (Bits & 0x01) DrawPixelFast( Device, X, Y, Color );
+	} else if (Device->Depth == 4) {
+		uint8_t *FBOffset = Device->Framebuffer + (Y * Device->Width >> 1);
+		Color &= 0x0f;
+		for (; Bits; Bits >>= 1, X++) {
+			if (!(Bits & 0x01)) continue;
+			if (X & 0x01) FBOffset[X >> 1] = (FBOffset[X >> 1] & 0x0f) | (Color << 4);
+			else FBOffset[X >> 1] = (FBOffset[X >> 1] & 0xf0) | Color;
+		}
+	} else if (Device->Depth == 8) {
+		uint8_t *FBOffset = Device->Framebuffer + Y * Device->Width + X;
+		for (; Bits; Bits >>= 1, FBOffset++) if (Bits & 0x01) *FBOffset = Color;
+	} else if (Device->Depth == 16) {
+		uint16_t *FBOffset = (uint16_t*) Device->Framebuffer + Y * Device->Width + X;
+		Color = __builtin_bswap16(Color);
+		for (; Bits; Bits >>= 1, FBOffset++) if (Bits & 0x01) *FBOffset = Color;
+	} else if (Device->Depth == 24) {
+		uint8_t *FBOffset = Device->Framebuffer + (Y * Device->Width + X) * 3;
+		uint8_t R = Color >> 16, G = Color >> 8, B = Color;
+		if (Device->Mode == GDS_RGB666) { R = Color >> 12; G = (Color >> 6) & 0x3f; B = Color & 0x3f; }
+		for (; Bits; Bits >>= 1, FBOffset += 3) if (Bits & 0x01) { FBOffset[0] = R; FBOffset[1] = G; FBOffset[2] = B; }
+	}
+}
+
+static void DrawCharRotated( struct GDS_Device* Device, char Character, int x, int y, int Color, int Angle ) {
+	const uint8_t* GlyphData = GetCharPtr( Device->Font, Character );
+	int GlyphColumnLen = RoundUpFontHeight( Device->Font ) / 8;
+	int CharWidth = GetCharWidth( Device, Character );
+	int CharHeight = Device->Font->Height;
+	int First, Last;
+
+	if ( Character < Device->Font->StartChar || Character > Device->Font->EndChar ) return;
+
+	// glyph is CharHeight wide and CharWidth high once rotated
+	if ( x + CharHeight <= 0 || x >= Device->Width || y + CharWidth <= 0 || y >= Device->Height ) {
+		ClipDebug( x, y );
+		return;
+	}
+
+	// visible range of glyph lines (bits) which become screen columns
+	if ( Angle == 90 ) {
+		First = x + CharHeight - Device->Width;
+		Last = x + CharHeight;
+	} else {
+		First = -x;
+		Last = Device->Width - x;
+	}
+	if ( First < 0 ) First = 0;
+	if ( Last > CharHeight ) Last = CharHeight;
+
+	/* The first byte in the glyph data is the width of the character in pixels, skip over */
+	GlyphData++;
+	Device->Dirty = true;
+
+	for ( int Column = 0; Column < CharWidth; Column++, GlyphData += GlyphColumnLen ) {
+		int Y = ( Angle == 90 ) ? y + Column : y + CharWidth - 1 - Column;
+
+		if ( Y < 0 || Y >= Device->Height ) continue;
+
+		for ( int i = 0; i < GlyphColumnLen; i++ ) {
+			int Lo = First - i * 8, Hi = Last - i * 8;
+			uint8_t Bits = GlyphData[i];
+
+			if ( !Bits || Hi <= 0 || Lo >= 8 ) continue;
+			if ( Lo > 0 ) Bits &= 0xff << Lo;
+			if ( Hi < 8 ) Bits &= 0xff >> (8 - Hi);
+			if ( !Bits ) continue;
+
+			// glyph line 0 is the right-most column at 90 and the left-most at 270
+			if ( Angle == 90 ) DrawRowBits( Device, x + CharHeight - 8 - i * 8, Y, ReverseByte( Bits ), Color );
+			else DrawRowBits( Device, x + i * 8, Y, Bits, Color );
+		}
+	}
+}
+
+void GDS_FontDrawStringRotated( struct GDS_Device* Display, int x, int y, const char* Text, int Color, int Angle ) {
+	NullCheck( Text, return );
+	CheckBounds( Angle != 90 && Angle != 270, return );
+	CheckBounds( Display->Font->Depth == 4, return );
+
+	// string goes downward at 90 and upward at 270, (x,y) is always the top-left corner
+	if ( Angle == 270 ) for ( const char *p = Text; *p; p++ ) y += GetCharWidth( Display, *p );
+
+	for ( ; *Text; Text++ ) {
+		int Width = GetCharWidth( Display, *Text );
+
+		if ( Angle == 270 ) y -= Width;
+		DrawCharRotated( Display, *Text, x, y, Color, Angle );
+		if ( Angle == 90 ) y += Width;
+	}
+}
+
 bool GDS_SetFont( struct GDS_Device* Display, const struct GDS_FontDef* Font ) {
     Display->FontForceProportional = false;
     Display->FontForceMonospace = false;
+    Display->FontScale = 1;
+    Display->FontBackground = GDS_COLOR_BLACK;
     Display->Font = Font;
 
     return true;
@@ -114,45 +440,36 @@ void GDS_FontForceMonospace( struct GDS_Device* Display, bool Force ) {
     Display->FontForceMonospace = Force;
 }
 
+void GDS_FontSetScale( struct GDS_Device* Display, int Scale ) {
+    Display->FontScale = Scale;
+}
+
+void GDS_FontSetBackground( struct GDS_Device* Display, int Color ) {
+    Display->FontBackground = Color;
+}
+
 int GDS_FontGetWidth( struct GDS_Device* Display ) {
-    return Display->Font->Width;
+    return Display->Font->Width * GetScale( Display );
 }
 
 int GDS_FontGetHeight( struct GDS_Device* Display ) {
-    return Display->Font->Height;
+    return Display->Font->Height * GetScale( Display );
 }
 
 int GDS_FontGetCharWidth( struct GDS_Device* Display, char Character ) {
-    const uint8_t* CharPtr = NULL;
-    int Width = 0;
-
-    if ( Character >= Display->Font->StartChar && Character <= Display->Font->EndChar ) {
-        CharPtr = GetCharPtr( Display->Font, Character );
-
-        Width = ( Display->Font->Monospace == true ) ? Display->Font->Width : *CharPtr;
-
-        if ( Display->FontForceMonospace == true ) {
-            Width = Display->Font->Width;
-        }
-
-        if ( Display->FontForceProportional == true ) {
-            Width = *CharPtr;
-        }
-    }
-
-    return Width;
+    return GetCharWidth( Display, Character ) * GetScale( Display );
 }
 
 int GDS_FontGetMaxCharsPerRow( struct GDS_Device* Display ) {
-    return Display->Width / Display->Font->Width;
+    return Display->Width / GDS_FontGetWidth( Display );
 }
 
 int GDS_FontGetMaxCharsPerColumn( struct GDS_Device* Display ) {
-    return Display->Height / Display->Font->Height;    
+    return Display->Height / GDS_FontGetHeight( Display );
 }
 
 int GDS_FontGetCharHeight( struct GDS_Device* Display ) {
-    return Display->Font->Height;
+    return GDS_FontGetHeight( Display );
 }
 
 int GDS_FontMeasureString( struct GDS_Device* Display, const char* Text ) {
@@ -268,3 +585,111 @@ void GDS_FontGetAnchoredStringCoords( struct GDS_Device* Display, int* OutX, int
         }
     };
 }
+
+/****************************************************************************************
+ * Fonts can be loaded from a blob that is memory-mapped (a data partition on target, a 
+ * file on host) so that glyphs are never copied into RAM. The blob is a 16 bytes header, 
+ * little endian, followed by glyph data exactly as for built-in fonts
+ *	[0..3]	"GDSF"
+ *	[4]		version (1)
+ *	[5]		depth (0/1 = X-GLCD, 4 = antialiased)
+ *	[6]		monospace
+ *	[7]		reserved
+ *	[8..9]	width, [10..11] height, [12..13] start char, [14..15] end char
+ */
+#define FONT_HEADER_SIZE	16
+#define FONT_VERSION		1
+
+static char TAG[] = "gds_font";
+
+struct LoadedFont {
+	struct GDS_FontDef Font;		// must be first
+#ifdef ESP_PLATFORM
+	spi_flash_mmap_handle_t Handle;
+#else
+	const void *Map;
+	size_t Size;
+#endif
+};
+
+// returns blob size or 0 if header is not valid
+static size_t ParseHeader( const uint8_t *Header, struct GDS_FontDef *Font ) {
+	if (memcmp(Header, "GDSF", 4) || Header[4] != FONT_VERSION) return 0;
+
+	Font->Depth = Header[5];
+	Font->Monospace = Header[6];
+	Font->Width = Header[8] | (Header[9] << 8);
+	Font->Height = Header[10] | (Header[11] << 8);
+	Font->StartChar = Header[12] | (Header[13] << 8);
+	Font->EndChar = Header[14] | (Header[15] << 8);
+
+	if (Font->EndChar < Font->StartChar || !Font->Width || !Font->Height || (Font->Depth > 1 && Font->Depth != 4)) return 0;
+
+	return FONT_HEADER_SIZE + (Font->EndChar - Font->StartChar + 1) * (1 + Font->Width * GetColumnLen( Font ));
+}
+
+const struct GDS_FontDef* GDS_FontLoad( const char *Name ) {
+	struct LoadedFont *Loaded;
+	uint8_t Header[FONT_HEADER_SIZE];
+	const void *Map;
+	size_t Size;
+
+	NullCheck( Name, return NULL );
+	Loaded = calloc( 1, sizeof(struct LoadedFont) );
+	NullCheck( Loaded, return NULL );
+
+#ifdef ESP_PLATFORM
+	const esp_partition_t *Partition = esp_partition_find_first( ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, Name );
+
+	if (!Partition || esp_partition_read( Partition, 0, Header, FONT_HEADER_SIZE ) != ESP_OK || 
+		(Size = ParseHeader( Header, &Loaded->Font )) == 0 || Size > Partition->size) {
+		ESP_LOGE(TAG, "can't find a valid font in partition %s", Name);
+		free(Loaded);
+		return NULL;
+	}
+
+	ESP_ERROR_CHECK_NONFATAL( esp_partition_mmap( Partition, 0, Size, SPI_FLASH_MMAP_DATA, &Map, &Loaded->Handle ), { free(Loaded); return NULL; } );
+#else
+	struct stat Stat;
+	int fd = open( Name, O_RDONLY );
+
+	if (fd < 0 || fstat( fd, &Stat ) || read( fd, Header, FONT_HEADER_SIZE ) != FONT_HEADER_SIZE ||
+		(Size = ParseHeader( Header, &Loaded->Font )) == 0 || Size > Stat.st_size) {
+		ESP_LOGE(TAG, "can't find a valid font in file %s", Name);
+		if (fd >= 0) close( fd );
+		free(Loaded);
+		return NULL;
+	}
+
+	// mapping survives the file descriptor
+	Map = mmap( NULL, Size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	close( fd );
+
+	if (Map == MAP_FAILED) {
+		ESP_LOGE(TAG, "can't map font file %s", Name);
+		free(Loaded);
+		return NULL;
+	}
+
+	Loaded->Map = Map;
+	Loaded->Size = Size;
+#endif
+
+	Loaded->Font.FontData = (const uint8_t*) Map + FONT_HEADER_SIZE;
+	ESP_LOGI(TAG, "mapped font %s %dx%d (chars %d..%d, depth %d)", Name, Loaded->Font.Width, Loaded->Font.Height, 
+			 Loaded->Font.StartChar, Loaded->Font.EndChar, Loaded->Font.Depth);
+
+	return &Loaded->Font;
+}
+
+void GDS_FontUnload( const struct GDS_FontDef* Font ) {
+	struct LoadedFont *Loaded = (struct LoadedFont*) Font;
+
+	if (!Loaded) return;
+#ifdef ESP_PLATFORM
+	spi_flash_munmap( Loaded->Handle );
+#else
+	munmap( (void*) Loaded->Map, Loaded->Size );
+#endif
+	free(Loaded);
+}
@@ -20,6 +20,10 @@ struct GDS_Device;
  * 'a': [Glyph width][Pixel column 0][Pixel column 1] where the number of pixel columns is the font height divided by 8
  * 'b': [Glyph width][Pixel column 0][Pixel column 1]...
  * 'c': And so on...
+ *
+ * When Depth is 4, glyphs are antialiased: each pixel is a 4 bits alpha and a column is 
+ * (Height + 1) / 2 bytes, low nibble first going down. First byte is still the width.
+ * Depth 0 (default) or 1 is X-GLCD.
  */
  
 struct GDS_FontDef {
@@ -32,6 +36,8 @@ struct GDS_FontDef {
     int EndChar;
 
     bool Monospace;
+
+    uint8_t Depth;
 };
 
 typedef enum {
@@ -50,6 +56,10 @@ bool GDS_SetFont( struct GDS_Device* Display, const struct GDS_FontDef* Font );
 
 void GDS_FontForceProportional( struct GDS_Device* Display, bool Force );
 void GDS_FontForceMonospace( struct GDS_Device* Display, bool Force );
+// integer up-scaling of current font (reset by GDS_SetFont), not applied to rotated text
+void GDS_FontSetScale( struct GDS_Device* Display, int Scale );
+// background antialiased (4 bits) fonts are blended with (reset by GDS_SetFont)
+void GDS_FontSetBackground( struct GDS_Device* Display, int Color );
 
 int GDS_FontGetWidth( struct GDS_Device* Display );
 int GDS_FontGetHeight( struct GDS_Device* Display );
@@ -65,10 +75,19 @@ void GDS_FontDrawChar( struct GDS_Device* Display, char Character, int x, int y,
 void GDS_FontDrawString( struct GDS_Device* Display, int x, int y, const char* Text, int Color );
 void GDS_FontDrawAnchoredString( struct GDS_Device* Display, TextAnchor Anchor, const char* Text, int Color );
 void GDS_FontGetAnchoredStringCoords( struct GDS_Device* Display, int* OutX, int* OutY, TextAnchor Anchor, const char* Text );
+// Angle is 90 (clockwise, reads downward) or 270 (reads upward), x,y is top-left of rotated string
+void GDS_FontDrawStringRotated( struct GDS_Device* Display, int x, int y, const char* Text, int Color, int Angle );
+
+// font blob is memory-mapped from a data partition (label) on target or a file on host
+const struct GDS_FontDef* GDS_FontLoad( const char *Name );
+// must not be the current font of any device
+void GDS_FontUnload( const struct GDS_FontDef* Font );
 
 extern const struct GDS_FontDef Font_droid_sans_fallback_11x13;
 extern const struct GDS_FontDef Font_droid_sans_fallback_15x17;
 extern const struct GDS_FontDef Font_droid_sans_fallback_24x28;
+// 4 bits antialiased
+extern const struct GDS_FontDef Font_droid_sans_fallback_aa_12x14;
 
 extern const struct GDS_FontDef Font_droid_sans_mono_7x13;
 extern const struct GDS_FontDef Font_droid_sans_mono_13x24;
@@ -7,33 +7,66 @@
  */
  
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/time.h>
 #include "math.h"
-#include "esp32/rom/tjpgd.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#ifdef ESP_PLATFORM
+#include "esp_pthread.h"
+#include "esp_partition.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "gds.h"
 #include "gds_private.h"
 #include "gds_image.h"
 
-const char TAG[] = "ImageDec";
+// bundled decoder outputs RGB565 or grayscale directly and has faster huffman & larger 
+// input buffer, but needs more memory. Host builds have no ROM so always use it
+//#define USE_BUNDLED_TJPGD
 
+#if defined USE_BUNDLED_TJPGD || !defined ESP_PLATFORM
+#ifndef USE_BUNDLED_TJPGD
+#define USE_BUNDLED_TJPGD
+#endif
+#include "gds_tjpgd.h"
+#define SCRATCH_SIZE	JD_SZPOOL
+#else
+#include "esp32/rom/tjpgd.h"
 #define SCRATCH_SIZE	3100
+#endif
+
+#include "esp32/rom/miniz.h"
+
+const char TAG[] = "ImageDec";
+
+#define DECODE_QUEUE	4
+#define DECODE_STACK	4096
 
 //Data that is passed from the decoder function to the infunc/outfunc functions.
 typedef struct {
     const unsigned char *InData;	// Pointer to jpeg data
     int InPos;						// Current position in jpeg data
-	int Width, Height;	
+	size_t InSize;					// bytes in jpeg data, 0 when unknown
+	GDS_ReadFunc *Read;				// or streamed jpeg data
+	void *Handle;
+	atomic_bool *Abort;				// decoding is cancelled when set
+	int Width, Height;				// final size, after resampling
+	int XStep, YStep;				// 16.16 from decoded (2^N scaled) to final size
 	uint8_t Mode;
-	union {
-		void *OutData;
-		struct {						// DirectDraw
-			struct GDS_Device *Device;
-			int XOfs, YOfs;
-			int XMin, YMin;
-			int Depth;
-		};	
-	};	
+	uint8_t Bytes;					// per decoded pixel (3 = RGB888, 2 = RGB565, 1 = gray)
+	void *OutData;					// decode in a bitmap
+	int Stride;						// in pixels
+	struct GDS_Device *Device;		// or DirectDraw
+	int XOfs, YOfs;
+	int XMin, YMin;
+	int Depth;
 } JpegCtx;
 
 /****************************************************************************************
@@ -70,37 +103,144 @@ static inline int ScalerGray(uint8_t *Pixels) {
 	return (Pixels[2] * 14 + Pixels[1] * 76 + Pixels[0] * 38) >> 7;
 }
 
+// bundled decoder already did the conversion
+static inline int Native16(uint8_t *Pixels) {
+	return *(uint16_t*) Pixels;
+}
+
+static inline int Native8(uint8_t *Pixels) {
+	return *Pixels;
+}
+
+// let the decoder output in final format when it can
+static void SetFormat(JDEC *Decoder, JpegCtx *Context, int Mode) {
+	Context->Mode = Mode;
+	Context->Bytes = 3;
+#ifdef USE_BUNDLED_TJPGD
+	if (Mode == GDS_RGB565) {
+		Decoder->format = JD_FMT_RGB565;
+		Context->Bytes = 2;
+	} else if (Mode <= GDS_GRAYSCALE) {
+		Decoder->format = JD_FMT_GRAY;
+		Context->Bytes = 1;
+	}	
+#endif	
+}
+
+static inline int ModeBytes(int RGB_Mode) {
+	return RGB_Mode <= GDS_RGB332 ? 1 : (RGB_Mode < GDS_RGB666 ? 2 : 3);
+}
+
 static unsigned InHandler(JDEC *Decoder, uint8_t *Buf, unsigned Len) {
     JpegCtx *Context = (JpegCtx*) Decoder->device;
+	
+	// streamed data might come by smaller chunks than requested (NULL Buf is a skip)
+	if (Context->Read) {
+		unsigned Bytes = 0;
+		for (int Count; Bytes < Len; Bytes += Count) {
+			Count = Context->Read(Context->Handle, Buf ? Buf + Bytes : NULL, Len - Bytes);
+			if (Count <= 0) break;
+		}	
+		Context->InPos += Bytes;
+		return Bytes;
+	}
+	
+	// never read past a known end (decoder reads ahead by JD_SZBUF)
+	if (Context->InSize && Context->InPos + Len > Context->InSize) {
+		Len = (size_t) Context->InPos < Context->InSize ? Context->InSize - Context->InPos : 0;
+	}	
     if (Buf) memcpy(Buf, Context->InData +  Context->InPos, Len);
     Context->InPos += Len;
     return Len;
 }
 
-#define OUTHANDLER(F)										\
-	for (int y = Frame->top; y <= Frame->bottom; y++) {		\
-		for (int x = Frame->left; x <= Frame->right; x++) {	\
-			OutData[Context->Width * y + x] = F(Pixels);	\
-			Pixels += 3;									\
-		}													\
+/****************************************************************************************
+ * Resampling of decoded (2^N scaled) MCU to final size, using nearest pixel. A frame
+ * yields destination rectangle and byte offsets of source pixels to pick. Step is 
+ * never below 1.0 so there are no more of them than the 16x16 MCU's pixels
+ */
+static inline int DestStart(int Pos, int Step) {
+	return ((Pos << 16) + Step - 1) / Step;
+}
+
+static bool MapFrame(JpegCtx *Context, JRECT *Frame, JRECT *Dest, uint8_t *XMap, uint16_t *YMap) {
+	int Left = DestStart(Frame->left, Context->XStep), Right = DestStart(Frame->right + 1, Context->XStep) - 1;
+	int Top = DestStart(Frame->top, Context->YStep), Bottom = DestStart(Frame->bottom + 1, Context->YStep) - 1;
+	int Stride = (Frame->right - Frame->left + 1) * Context->Bytes;
+	
+	if (Right >= Context->Width) Right = Context->Width - 1;
+	if (Bottom >= Context->Height) Bottom = Context->Height - 1;
+	if (Left > Right || Top > Bottom) return false;
+	
+	for (int x = Left; x <= Right; x++) *XMap++ = (((x * Context->XStep) >> 16) - Frame->left) * Context->Bytes;
+	for (int y = Top; y <= Bottom; y++) *YMap++ = (((y * Context->YStep) >> 16) - Frame->top) * Stride;
+	
+	*Dest = (JRECT) { .left = Left, .right = Right, .top = Top, .bottom = Bottom };
+	return true;
+}
+
+// largest 2^N decoder scaling that stays above final size, the rest is resampling
+static uint8_t SetScale(JpegCtx *Context, int Width, int Height) {
+	uint8_t N = 0;
+	
+	while (N < 3 && (Width >> (N + 1)) >= Context->Width && (Height >> (N + 1)) >= Context->Height) N++;
+	Context->XStep = ((Width >> N) << 16) / Context->Width;
+	Context->YStep = ((Height >> N) << 16) / Context->Height;
+	
+	return N;
+}
+
+// downscale to fit in a box, keeping aspect ratio
+static void FitSize(JpegCtx *Context, int Width, int Height, int MaxWidth, int MaxHeight) {
+	float XRatio = MaxWidth / (float) Width, YRatio = MaxHeight / (float) Height;
+	float Ratio = XRatio < YRatio ? XRatio : YRatio;
+
+	Context->Width = Width;
+	Context->Height = Height;
+	
+	if (Ratio < 1) {
+		Context->Width = Width * Ratio;
+		Context->Height = Height * Ratio;
+		if (Context->Width <= 0) Context->Width = 1;
+		if (Context->Height <= 0) Context->Height = 1;
+	}	
+}
+
+#define OUTHANDLER(F)													\
+	for (int y = Dest.top, r = 0; y <= Dest.bottom; y++, r++) {			\
+		uint8_t *Row = Pixels + YMap[r];								\
+		for (int x = Dest.left, c = 0; x <= Dest.right; x++, c++) {		\
+			OutData[Context->Stride * y + x] = F(Row + XMap[c]);		\
+		}																\
 	}	
 	
 #define OUTHANDLER24(F)													\
-	for (int y = Frame->top; y <= Frame->bottom; y++) {					\
-		uint8_t *p = OutData + (Context->Width * y + Frame->left) * 3;	\
-		for (int c = Frame->right - Frame->left; c-- >= 0;) {			\
-			uint32_t v = F(Pixels);										\
+	for (int y = Dest.top, r = 0; y <= Dest.bottom; y++, r++) {			\
+		uint8_t *p = OutData + (Context->Stride * y + Dest.left) * 3;	\
+		uint8_t *Row = Pixels + YMap[r];								\
+		for (int c = 0; c <= Dest.right - Dest.left; c++) {				\
+			uint32_t v = F(Row + XMap[c]);								\
 			*p++ = v; *p++ = v >> 8; *p++ = v >> 16;					\
-			Pixels += 3;												\
 		}																\
 	}		
 
 static unsigned OutHandler(JDEC *Decoder, void *Bitmap, JRECT *Frame) {
 	JpegCtx *Context = (JpegCtx*) Decoder->device;
-    uint8_t *Pixels = (uint8_t*) Bitmap;
+    uint8_t *Pixels = (uint8_t*) Bitmap, XMap[16];
+	uint16_t YMap[16];
+	JRECT Dest;
+	
+	if (Context->Abort && *Context->Abort) return 0;
+	if (!MapFrame(Context, Frame, &Dest, XMap, YMap)) return 1;
 
-	// decoded image is RGB888
-	if (Context->Mode == GDS_RGB888) {
+	// decoded image is RGB888, unless decoder did the job
+	if (Context->Bytes == 2) {
+		uint16_t *OutData = (uint16_t*) Context->OutData;
+		OUTHANDLER(Native16);		
+	} else if (Context->Bytes == 1) {
+		uint8_t *OutData = (uint8_t*) Context->OutData;		
+		OUTHANDLER(Native8);
+	} else if (Context->Mode == GDS_RGB888) {
 		uint8_t *OutData = (uint8_t*) Context->OutData;		
 		OUTHANDLER24(Scaler888);
 	} else if (Context->Mode == GDS_RGB666) {
@@ -126,109 +266,541 @@ static unsigned OutHandler(JDEC *Decoder, void *Bitmap, JRECT *Frame) {
     return 1;
 }
 
-// Convert the RGB888 to destination color plane, use DrawPixel and not "fast" 
-// version as X,Y may be beyond screen				
-#define OUTHANDLERDIRECT(F,S)																		\
-	for (int y = Frame->top; y <= Frame->bottom; y++) {												\
-		if (y < Context->YMin) continue;															\
-		for (int x = Frame->left; x <= Frame->right; x++) {											\
-			if (x < Context->XMin) continue;														\
-			DrawPixel( Context->Device, x + Context->XOfs, y + Context->YOfs, F(Pixels) >> S);	\
-			Pixels += 3;																			\
-		}																							\
+/****************************************************************************************
+ *  Ordered dithering for 1 and 4 bits grayscale: an 8 bits gray G becomes level 
+ *  (G * Levels + Threshold) >> 8 where threshold is taken from a 8x8 Bayer matrix 
+ *  (scaled to 0..255) at screen position. Without dithering, 1 bit uses a flat 128
+ */
+static bool Dither;
+
+static const uint8_t DRAM_ATTR Bayer[8][8] = {
+	{   2, 130,  34, 162,  10, 138,  42, 170 },
+	{ 194,  66, 226,  98, 202,  74, 234, 106 },
+	{  50, 178,  18, 146,  58, 186,  26, 154 },
+	{ 242, 114, 210,  82, 250, 122, 218,  90 },
+	{  14, 142,  46, 174,   6, 134,  38, 166 },
+	{ 206,  78, 238, 110, 198,  70, 230, 102 },
+	{  62, 190,  30, 158,  54, 182,  22, 150 },
+	{ 254, 126, 222,  94, 246, 118, 214,  86 },
+};
+
+static const uint8_t DRAM_ATTR NoDither[8][8] = { [0 ... 7] = { [0 ... 7] = 128 } };
+
+void GDS_ImageSetDither(bool Enable) {
+	Dither = Enable;
+}
+
+// Convert the RGB888 to destination color plane and write whole rows in the framebuffer.
+// MCU is clipped once, then each depth W has its own row writer: INIT sets P at row's 
+// first byte, STORE writes pixel V at screen column X and END flushes what's left
+#define OUTHANDLERDIRECT(F,S,W)															\
+	for (int y = Top; y <= Bottom; y++) {												\
+		uint8_t *Row = Pixels + YMap[y - Dest.top], *Pick = XMap + Left - Dest.left;	\
+		int Y = y + Context->YOfs, X = Left + Context->XOfs;							\
+		DIRECT_INIT_##W;																\
+		for (int c = Right - Left; c-- >= 0; X++) {										\
+			uint32_t V = F(Row + *Pick++) >> (S);										\
+			DIRECT_STORE_##W;															\
+		}																				\
+		DIRECT_END_##W;																	\
 	}
-	
+
+// same as above for grayscale with dithering (Levels is 1 or 15)
+#define OUTHANDLERDITHER(F,W)															\
+	for (int y = Top; y <= Bottom; y++) {												\
+		uint8_t *Row = Pixels + YMap[y - Dest.top], *Pick = XMap + Left - Dest.left;	\
+		int Y = y + Context->YOfs, X = Left + Context->XOfs;							\
+		const uint8_t *Threshold = Bayer[Y & 7];										\
+		DIRECT_INIT_##W;																\
+		for (int c = Right - Left; c-- >= 0; X++) {										\
+			uint32_t V = (F(Row + *Pick++) * Levels + Threshold[X & 7]) >> 8;			\
+			DIRECT_STORE_##W;															\
+		}																				\
+		DIRECT_END_##W;																	\
+	}
+
+// vertical pages: each byte is built from up to 8 rows so framebuffer is written once per page
+#define OUTHANDLERPAGE(F)																		\
+	for (int y = Top, Last; y <= Bottom; y = Last + 1) {										\
+		int Y = y + Context->YOfs, X = Left + Context->XOfs;									\
+		Last = y + 7 - (Y & 7);																	\
+		if (Last > Bottom) Last = Bottom;														\
+		uint8_t Mask = (0xff << (Y & 7)) & (0xff >> (7 - ((Last + Context->YOfs) & 7)));		\
+		uint8_t *P = Device->Framebuffer + (Y >> 3) * Device->Width + X, *Pick = XMap + Left - Dest.left;	\
+		for (int c = Right - Left; c-- >= 0; X++, Pick++) {										\
+			uint8_t Bits = 0;																	\
+			for (int r = y; r <= Last; r++) {													\
+				int Row = r + Context->YOfs;													\
+				Bits |= ((F(Pixels + YMap[r - Dest.top] + *Pick) + Threshold[Row & 7][X & 7]) >> 8) << (Row & 7);	\
+			}																					\
+			*P = (*P & ~Mask) | Bits;															\
+			P++;																				\
+		}																						\
+	}
+
+// driver has its own framebuffer layout
+#define DIRECT_INIT_FAST	
+#define DIRECT_STORE_FAST	Device->DrawPixelFast(Device, X, Y, V)
+#define DIRECT_END_FAST	
+
+#define DIRECT_INIT_8		uint8_t *P = Device->Framebuffer + Y * Device->Width + X
+#define DIRECT_STORE_8		*P++ = V
+#define DIRECT_END_8	
+
+#define DIRECT_INIT_16		uint16_t *P = (uint16_t*) Device->Framebuffer + Y * Device->Width + X
+#define DIRECT_STORE_16		*P++ = __builtin_bswap16(V)
+#define DIRECT_END_16	
+
+#define DIRECT_INIT_666		uint8_t *P = Device->Framebuffer + (Y * Device->Width + X) * 3
+#define DIRECT_STORE_666	*P++ = V >> 12; *P++ = (V >> 6) & 0x3f; *P++ = V & 0x3f
+#define DIRECT_END_666	
+
+#define DIRECT_INIT_888		uint8_t *P = Device->Framebuffer + (Y * Device->Width + X) * 3
+#define DIRECT_STORE_888	*P++ = V >> 16; *P++ = V >> 8; *P++ = V
+#define DIRECT_END_888	
+
+// nibbles are packed by pairs, odd X is the high one
+#define DIRECT_INIT_4		uint8_t *P = Device->Framebuffer + ((Y * Device->Width + X) >> 1), Low = *P & 0x0f
+#define DIRECT_STORE_4		if (X & 1) *P++ = Low | (V << 4); else Low = V
+#define DIRECT_END_4		if (X & 1) *P = (*P & 0xf0) | Low
+
 static unsigned OutHandlerDirect(JDEC *Decoder, void *Bitmap, JRECT *Frame) {
 	JpegCtx *Context = (JpegCtx*) Decoder->device;
-    uint8_t *Pixels = (uint8_t*) Bitmap;
-	int Shift = 8 - Context->Depth;
+	struct GDS_Device *Device = Context->Device;
+    uint8_t *Pixels = (uint8_t*) Bitmap, XMap[16];
+	uint16_t YMap[16];
+	JRECT Dest;
+	
+	// MCU rows come in order, so once below the screen, no need to decode further
+	if (!MapFrame(Context, Frame, &Dest, XMap, YMap)) return 1;
+	if (Dest.top + Context->YOfs >= Device->Height) return 0;
+	
+	// clip against requested area and screen, nothing to convert when outside
+	int Left = Dest.left, Right = Dest.right, Top = Dest.top, Bottom = Dest.bottom;
+	if (Left < Context->XMin) Left = Context->XMin;
+	if (Left < -Context->XOfs) Left = -Context->XOfs;
+	if (Right >= Device->Width - Context->XOfs) Right = Device->Width - Context->XOfs - 1;
+	if (Top < Context->YMin) Top = Context->YMin;
+	if (Top < -Context->YOfs) Top = -Context->YOfs;
+	if (Bottom >= Device->Height - Context->YOfs) Bottom = Device->Height - Context->YOfs - 1;
+	if (Left > Right || Top > Bottom) return 1;
+	
+	// only 1 and 4 bits grayscale are dithered
+	int Levels = (1 << Context->Depth) - 1;
+	bool Dithered = Dither && Context->Mode <= GDS_GRAYSCALE && Context->Depth < 8;
 	
 	// decoded image is RGB888, shift only make sense for grayscale
-	if (Context->Mode == GDS_RGB888) {
-		OUTHANDLERDIRECT(Scaler888, 0);
-	} else if (Context->Mode == GDS_RGB666) {
-		OUTHANDLERDIRECT(Scaler666, 0);		
-	} else if (Context->Mode == GDS_RGB565) {
-		OUTHANDLERDIRECT(Scaler565, 0);		
-	} else if (Context->Mode == GDS_RGB555) {
-		OUTHANDLERDIRECT(Scaler555, 0);				
-	} else if (Context->Mode == GDS_RGB444) {
-		OUTHANDLERDIRECT(Scaler444, 0);						
-	} else if (Context->Mode == GDS_RGB332) {
-		OUTHANDLERDIRECT(Scaler332, 0);						
-	} else if (Context->Mode <= GDS_GRAYSCALE) { 	 
-		OUTHANDLERDIRECT(ScalerGray, Shift);
+	if (Device->DrawPixelFast) {
+		if (Context->Mode == GDS_RGB888) {
+			OUTHANDLERDIRECT(Scaler888, 0, FAST);
+		} else if (Context->Mode == GDS_RGB666) {
+			OUTHANDLERDIRECT(Scaler666, 0, FAST);
+		} else if (Context->Bytes == 2) {
+			OUTHANDLERDIRECT(Native16, 0, FAST);
+		} else if (Dithered) {
+			if (Context->Bytes == 1) {
+				OUTHANDLERDITHER(Native8, FAST);
+			} else {
+				OUTHANDLERDITHER(ScalerGray, FAST);
+			}	
+		} else if (Context->Bytes == 1) {
+			OUTHANDLERDIRECT(Native8, 8 - Context->Depth, FAST);
+		} else if (Context->Mode == GDS_RGB565) {
+			OUTHANDLERDIRECT(Scaler565, 0, FAST);
+		} else if (Context->Mode == GDS_RGB555) {
+			OUTHANDLERDIRECT(Scaler555, 0, FAST);
+		} else if (Context->Mode == GDS_RGB444) {
+			OUTHANDLERDIRECT(Scaler444, 0, FAST);
+		} else if (Context->Mode == GDS_RGB332) {
+			OUTHANDLERDIRECT(Scaler332, 0, FAST);
+		} else if (Context->Mode <= GDS_GRAYSCALE) {
+			OUTHANDLERDIRECT(ScalerGray, 8 - Context->Depth, FAST);
+		}
+	} else if (Context->Depth == 16) {
+		if (Context->Bytes == 2) {
+			OUTHANDLERDIRECT(Native16, 0, 16);
+		} else if (Context->Mode == GDS_RGB565) {
+			OUTHANDLERDIRECT(Scaler565, 0, 16);
+		} else if (Context->Mode == GDS_RGB555) {
+			OUTHANDLERDIRECT(Scaler555, 0, 16);
+		} else if (Context->Mode == GDS_RGB444) {
+			OUTHANDLERDIRECT(Scaler444, 0, 16);
+		}
+	} else if (Context->Depth == 24) {
+		if (Context->Mode == GDS_RGB888) {
+			OUTHANDLERDIRECT(Scaler888, 0, 888);
+		} else if (Context->Mode == GDS_RGB666) {
+			OUTHANDLERDIRECT(Scaler666, 0, 666);
+		}
+	} else if (Context->Depth == 8) {
+		if (Context->Bytes == 1) {
+			OUTHANDLERDIRECT(Native8, 0, 8);
+		} else if (Context->Mode == GDS_RGB332) {
+			OUTHANDLERDIRECT(Scaler332, 0, 8);
+		} else if (Context->Mode <= GDS_GRAYSCALE) {
+			OUTHANDLERDIRECT(ScalerGray, 0, 8);
+		}
+	} else if (Context->Depth == 4) {
+		if (Dithered && Context->Bytes == 1) {
+			OUTHANDLERDITHER(Native8, 4);
+		} else if (Dithered) {
+			OUTHANDLERDITHER(ScalerGray, 4);
+		} else if (Context->Bytes == 1) {
+			OUTHANDLERDIRECT(Native8, 4, 4);
+		} else {
+			OUTHANDLERDIRECT(ScalerGray, 4, 4);
+		}	
+	} else if (Context->Depth == 1) {
+		const uint8_t (*Threshold)[8] = Dithered ? Bayer : NoDither;
+		if (Context->Bytes == 1) {
+			OUTHANDLERPAGE(Native8);
+		} else {
+			OUTHANDLERPAGE(ScalerGray);
+		}	
 	}
     
     return 1;
 }
 
+/****************************************************************************************
+ *  Decoder's workspace is owned by a GDS_JpegDecoder that can be reused. One-shot calls 
+ *  share a default one, allocated once, unless it is busy (another task is decoding)
+ */
+struct GDS_JpegDecoder {
+	char *Scratch;
+};
+
+static struct {
+	pthread_mutex_t Mutex;
+	char *Scratch;
+} Shared = { .Mutex = PTHREAD_MUTEX_INITIALIZER };
+
+static char* AcquireScratch(struct GDS_JpegDecoder *Decoder) {
+	char *Scratch;
+	
+	if (Decoder) return Decoder->Scratch;
+	
+	if (pthread_mutex_trylock(&Shared.Mutex) == 0) {
+		if (!Shared.Scratch) Shared.Scratch = heap_caps_malloc(SCRATCH_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		if (!Shared.Scratch) Shared.Scratch = malloc(SCRATCH_SIZE);
+		if (Shared.Scratch) return Shared.Scratch;
+		pthread_mutex_unlock(&Shared.Mutex);
+	}	
+		
+	if ((Scratch = malloc(SCRATCH_SIZE)) == NULL) ESP_LOGE(TAG, "Cannot allocate workspace");
+	return Scratch;
+}
+
+static void ReleaseScratch(struct GDS_JpegDecoder *Decoder, char *Scratch) {
+	if (Decoder) return;
+	if (Scratch == Shared.Scratch) pthread_mutex_unlock(&Shared.Mutex);
+	else free(Scratch);
+}
+
+struct GDS_JpegDecoder* GDS_JpegDecoderCreate(bool Internal) {
+	struct GDS_JpegDecoder *Decoder = malloc(sizeof(struct GDS_JpegDecoder));
+	if (!Decoder) return NULL;
+	
+	if (Internal) Decoder->Scratch = heap_caps_malloc(SCRATCH_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	else Decoder->Scratch = malloc(SCRATCH_SIZE);
+	
+	if (!Decoder->Scratch) {
+		ESP_LOGE(TAG, "Cannot allocate workspace");
+		free(Decoder);
+		return NULL;
+	}	
+	
+	return Decoder;
+}
+
+void GDS_JpegDecoderDelete(struct GDS_JpegDecoder *Decoder) {
+	if (!Decoder) return;
+	free(Decoder->Scratch);
+	free(Decoder);
+}
+
+/****************************************************************************************
+ *  Walk markers up to start of scan (no decoding, no allocation), returns its offset or 
+ *  0 if not usable. Size is set as soon as a SOF is found. Nothing is read beyond Len
+ */
+static int ProbeJPEG(const uint8_t *Source, size_t Len, int *Width, int *Height) {
+	size_t Pos = 2;
+	
+	*Width = *Height = 0;
+	if (Len < 4 || Source[0] != 0xff || Source[1] != 0xd8) return 0;
+	
+	while (Pos + 4 <= Len && Source[Pos] == 0xff) {
+		uint8_t Marker = Source[Pos + 1];
+		int Length = (Source[Pos + 2] << 8) | Source[Pos + 3];
+		
+		if (Marker == 0xff) {
+			Pos++;
+			continue;
+		}	
+		if (Length < 2 || Marker == 0xd9) break;
+		
+		if (Marker >= 0xc0 && Marker <= 0xcf && Marker != 0xc4 && Marker != 0xc8 && Marker != 0xcc) {
+			if (Pos + 9 > Len) break;
+			*Height = (Source[Pos + 5] << 8) | Source[Pos + 6];
+			*Width = (Source[Pos + 7] << 8) | Source[Pos + 8];
+		} else if (Marker == 0xda) {
+			return *Width && *Height && Pos + 2 + Length <= Len ? Pos + 2 + Length : 0;
+		}
+		
+		Pos += 2 + Length;
+	}
+	
+	return 0;
+}
+
+// length up to EOI, 0 if not within Len (segments have a length up to SOS, then FF are stuffed)
+static size_t JpegLength(const uint8_t *Data, size_t Len) {
+	size_t Pos = 2;
+	
+	while (Pos + 4 <= Len && Data[Pos] == 0xff) {
+		uint8_t Marker = Data[Pos + 1];
+		if (Marker == 0xff) {
+			Pos++;
+			continue;
+		}	
+		if (Marker == 0xd9) return Pos + 2;
+		Pos += 2 + ((Data[Pos + 2] << 8) | Data[Pos + 3]);
+		if (Marker == 0xda) break;
+	}
+	
+	for (; Pos + 1 < Len; Pos++) {
+		if (Data[Pos] == 0xff && Data[Pos + 1] == 0xd9) return Pos + 2;
+	}	
+	
+	return 0;
+}
+
 //Decode the embedded image into pixel lines that can be used with the rest of the logic.
-static void* DecodeJPEG(uint8_t *Source, int *Width, int *Height, float Scale, bool SizeOnly, int RGB_Mode) {
+static void* DecodeJPEG(struct GDS_JpegDecoder *Owner, JpegCtx *Input, int *Width, int *Height, float Scale, int RGB_Mode) {
     JDEC Decoder;
-    JpegCtx Context;
-	char *Scratch = calloc(SCRATCH_SIZE, 1);
+    JpegCtx Context = *Input;
+	char *Scratch = AcquireScratch(Owner);
+	bool Allocated = false;
 	
-    if (!Scratch) {
-        ESP_LOGE(TAG, "Cannot allocate workspace");
-        return NULL;
-    }
-
-	Context.OutData = NULL;
-    Context.InData = Source;
-    Context.InPos = 0;
+    if (!Scratch) return NULL;
 	        
     //Prepare and decode the jpeg.
     int Res = jd_prepare(&Decoder, InHandler, Scratch, SCRATCH_SIZE, (void*) &Context);
-	if (Width) *Width = Decoder.width;
-	if (Height) *Height = Decoder.height;
-	Decoder.scale = Scale;
 
-    if (Res == JDR_OK && !SizeOnly) {
-		if (RGB_Mode <= GDS_RGB332) Context.OutData = malloc(Decoder.width * Decoder.height);
-		else if (RGB_Mode < GDS_RGB666) Context.OutData = malloc(Decoder.width * Decoder.height * 2);
-		else if (RGB_Mode <= GDS_RGB888) Context.OutData = malloc(Decoder.width * Decoder.height * 3);
+    if (Res == JDR_OK) {
+		// final size might be already set, otherwise use scale (no upscaling) 
+		if (!Context.Width || !Context.Height) {
+			if (Scale > 1) Scale = 1;
+			Context.Width = Decoder.width * Scale;
+			Context.Height = Decoder.height * Scale;
+			if (!Context.Width) Context.Width = 1;
+			if (!Context.Height) Context.Height = 1;
+		}	
+		if (Context.Width > Decoder.width) Context.Width = Decoder.width;
+		if (Context.Height > Decoder.height) Context.Height = Decoder.height;
+		
+		uint8_t N = SetScale(&Context, Decoder.width, Decoder.height);
 		
-		// find the scaling factor
-		uint8_t N = 0, ScaleInt =  ceil(1.0 / Scale);
-		ScaleInt--; ScaleInt |= ScaleInt >> 1; ScaleInt |= ScaleInt >> 2; ScaleInt++;
-		while (ScaleInt >>= 1) N++;
-		if (N > 3) {
-			ESP_LOGW(TAG, "Image will not fit %dx%d", Decoder.width, Decoder.height);
-			N = 3;
+		// bitmap is sized for final image, unless caller provides it
+		if (!Context.OutData && RGB_Mode <= GDS_RGB888) {
+			Context.OutData = malloc(Context.Width * Context.Height * ModeBytes(RGB_Mode));
+			Context.Stride = Context.Width;
+			Allocated = true;
 		}	
 		
 		// ready to decode		
-		if (Context.OutData) {
-			Context.Width = Decoder.width / (1 << N);
-			Context.Height = Decoder.height / (1 << N);
-			Context.Mode = RGB_Mode;
-			if (Width) *Width = Context.Width;
-			if (Height) *Height = Context.Height;
+		if (Context.OutData && RGB_Mode <= GDS_RGB888) {
+			SetFormat(&Decoder, &Context, RGB_Mode);
 			Res = jd_decomp(&Decoder, OutHandler, N);
-			if (Res != JDR_OK) {
+			if (Res == JDR_INTR || (Res != JDR_OK && !Allocated)) {
+				if (Allocated) free(Context.OutData);
+				Context.OutData = NULL;
+			} 
+			if (Res != JDR_OK && Res != JDR_INTR) {
 				ESP_LOGE(TAG, "Image decoder: jd_decode failed (%d)", Res);
 			}	
 		} else {
-			ESP_LOGE(TAG, "Can't allocate bitmap %dx%d or invalid mode %d", Decoder.width, Decoder.height, RGB_Mode);			
+			ESP_LOGE(TAG, "Can't allocate bitmap %dx%d or invalid mode %d", Context.Width, Context.Height, RGB_Mode);			
+			Context.OutData = NULL;
 		}	
-	} else if (!SizeOnly) {
+	} else {
         ESP_LOGE(TAG, "Image decoder: jd_prepare failed (%d)", Res);
+		Context.OutData = NULL;
     }    
 
-	// free scratch area
-    if (Scratch) free(Scratch);
+	// caller's box (when any) is only overwritten on success
+	if (Context.OutData) {
+		if (Width) *Width = Context.Width;
+		if (Height) *Height = Context.Height;
+	}	
+
+	ReleaseScratch(Owner, Scratch);
     return Context.OutData;
 }
 
 void* GDS_DecodeJPEG(uint8_t *Source, int *Width, int *Height, float Scale, int RGB_Mode) {
-	return DecodeJPEG(Source, Width, Height, Scale, false, RGB_Mode);
+	JpegCtx Context = { .InData = Source };
+	return DecodeJPEG(NULL, &Context, Width, Height, Scale, RGB_Mode);
+}	
+
+bool GDS_DecodeJPEGInto(uint8_t *Source, void *Buffer, int Stride, int *Width, int *Height, int RGB_Mode) {
+	JpegCtx Context = { .InData = Source, .OutData = Buffer, .Stride = Stride };
+	int w, h;
+
+	if (!ProbeJPEG(Source, SIZE_MAX, &w, &h)) {
+		ESP_LOGE(TAG, "Not a baseline JPEG");
+		return false;
+	}	
+	
+	FitSize(&Context, w, h, *Width, *Height);
+	return DecodeJPEG(NULL, &Context, Width, Height, 1, RGB_Mode) != NULL;
+}	
+
+void* GDS_JpegDecoderDecode(struct GDS_JpegDecoder *Decoder, uint8_t *Source, int *Width, int *Height, float Scale, int RGB_Mode) {
+	JpegCtx Context = { .InData = Source };
+	return DecodeJPEG(Decoder, &Context, Width, Height, Scale, RGB_Mode);
+}	
+
+void* GDS_DecodeJPEGStream(GDS_ReadFunc *Read, void *Handle, int *Width, int *Height, float Scale, int RGB_Mode) {
+	JpegCtx Context = { .Read = Read, .Handle = Handle };
+	return DecodeJPEG(NULL, &Context, Width, Height, Scale, RGB_Mode);
 }	
 
 void GDS_GetJPEGSize(uint8_t *Source, int *Width, int *Height) {
-	DecodeJPEG(Source, Width, Height, 1, true, -1);
+	int w, h;
+	ProbeJPEG(Source, SIZE_MAX, &w, &h);
+	if (Width) *Width = w;
+	if (Height) *Height = h;
 }	
 
+/****************************************************************************************
+ *  Asynchronous decoding by a worker task (pthread, so it runs on host as well). Jobs 
+ *  are queued and processed in order, the one being decoded can be cancelled as well.
+ */
+typedef struct {
+	int Id;
+	uint8_t *Source;
+	float Scale;
+	int RGB_Mode;
+	GDS_DecodeDone *Done;
+	void *Arg;
+} DecodeJob;
+
+static struct {
+	pthread_t Thread;
+	pthread_mutex_t Mutex;
+	pthread_cond_t Cond;
+	bool Running;
+	atomic_bool Abort;
+	int Current, NextId, Count;
+	DecodeJob Jobs[DECODE_QUEUE];
+} Worker = { .Mutex = PTHREAD_MUTEX_INITIALIZER, .Cond = PTHREAD_COND_INITIALIZER };
+
+// pthread (so that it runs on host) pinned to a core (-1 = any) with given priority
+static bool StartThread(pthread_t *Thread, void *(*Routine)(void*), void *Arg, int Core, int Priority, const char *Name) {
+#ifdef ESP_PLATFORM
+	esp_pthread_cfg_t Previous = esp_pthread_get_default_config(), Config = esp_pthread_get_default_config();
+	esp_pthread_get_cfg(&Previous);
+	Config.stack_size = DECODE_STACK;
+	Config.prio = Priority;
+	Config.pin_to_core = Core < 0 ? tskNO_AFFINITY : Core;
+	Config.thread_name = Name;
+	esp_pthread_set_cfg(&Config);
+#endif	
+	bool Ret = pthread_create(Thread, NULL, Routine, Arg) == 0;
+#ifdef ESP_PLATFORM		
+	esp_pthread_set_cfg(&Previous);
+#endif
+	if (!Ret) ESP_LOGE(TAG, "Cannot start %s task", Name);
+	return Ret;
+}
+
+static void *DecodeWorker(void *Arg) {
+	struct GDS_JpegDecoder *Decoder = GDS_JpegDecoderCreate(true);
+	
+	pthread_mutex_lock(&Worker.Mutex);
+	
+	while (1) {
+		while (!Worker.Count) pthread_cond_wait(&Worker.Cond, &Worker.Mutex);
+
+		DecodeJob Job = Worker.Jobs[0];
+		memmove(Worker.Jobs, Worker.Jobs + 1, --Worker.Count * sizeof(DecodeJob));
+		Worker.Current = Job.Id;
+		Worker.Abort = false;
+		pthread_mutex_unlock(&Worker.Mutex);
+		
+		JpegCtx Context = { .InData = Job.Source, .Abort = &Worker.Abort };
+		int Width = 0, Height = 0;
+		void *Image = DecodeJPEG(Decoder, &Context, &Width, &Height, Job.Scale, Job.RGB_Mode);
+		
+		// cancellation is decided under lock so that callback is never called after it
+		pthread_mutex_lock(&Worker.Mutex);
+		Worker.Current = 0;
+		if (Worker.Abort) {
+			free(Image);
+		} else {
+			pthread_mutex_unlock(&Worker.Mutex);
+			Job.Done(Image, Width, Height, Job.Arg);
+			pthread_mutex_lock(&Worker.Mutex);
+		}	
+	}
+	
+	return NULL;
+}
+
+bool GDS_DecodeJPEGAsyncInit(int Core, int Priority) {
+	bool Ret = true;
+
+	pthread_mutex_lock(&Worker.Mutex);
+	
+	if (!Worker.Running) {
+		Worker.Running = Ret = StartThread(&Worker.Thread, DecodeWorker, NULL, Core, Priority, "gds_jpeg");
+	}	
+	
+	pthread_mutex_unlock(&Worker.Mutex);
+	return Ret;
+}
+
+int GDS_DecodeJPEGAsync(uint8_t *Source, float Scale, int RGB_Mode, GDS_DecodeDone *Done, void *Arg) {
+	int Id = 0;
+	
+	// use the other core by default (does nothing when already running)
+	if (!GDS_DecodeJPEGAsyncInit(1, 5)) return 0;
+	
+	pthread_mutex_lock(&Worker.Mutex);
+	
+	if (Worker.Count < DECODE_QUEUE) {
+		if (++Worker.NextId <= 0) Worker.NextId = 1;
+		Id = Worker.NextId;
+		Worker.Jobs[Worker.Count++] = (DecodeJob) { .Id = Id, .Source = Source, .Scale = Scale, 
+													.RGB_Mode = RGB_Mode, .Done = Done, .Arg = Arg };
+		pthread_cond_signal(&Worker.Cond);
+	} else {
+		ESP_LOGW(TAG, "Decoding queue is full");
+	}	
+	
+	pthread_mutex_unlock(&Worker.Mutex);
+	return Id;
+}
+
+bool GDS_DecodeJPEGCancel(int Job) {
+	bool Found = false;
+	
+	pthread_mutex_lock(&Worker.Mutex);
+	
+	if (Job && Worker.Current == Job) {
+		Worker.Abort = Found = true;
+	} else for (int i = 0; i < Worker.Count; i++) {
+		if (Worker.Jobs[i].Id != Job) continue;
+		memmove(Worker.Jobs + i, Worker.Jobs + i + 1, (--Worker.Count - i) * sizeof(DecodeJob));
+		Found = true;
+		break;
+	}
+	
+	pthread_mutex_unlock(&Worker.Mutex);
+	return Found;
+}
+
 /****************************************************************************************
  * RGB conversion (24 bits: RRRRRRRRGGGGGGGGBBBBBBBB and 16 bits 565: RRRRRGGGGGGBBBBB = B31..B0)
  * so in other words for an array of 888 bytes: [0]=B, [1]=G, [2]=R, ...
@@ -270,42 +842,110 @@ static inline int ToSelf(uint8_t **Pixel) {
 	return *(*Pixel)++; 
 }
 	
-#define DRAW_GRAYRGB(S,F)													\
-	if (Scale > 0) {														\
-		for (int r = 0; r < Height; r++) {									\
-			for (int c = 0; c < Width; c++) {								\
-				DrawPixel( Device, c + x, r + y, F(S) >> Scale);		\
-			}																\
-		}																	\
-	} else {																\
-		for (int r = 0; r < Height; r++) {									\
-			for (int c = 0; c < Width; c++) {								\
-				DrawPixel( Device, c + x, r + y, F(S) << -Scale);	\
-			}																\
-		}																	\
+static inline int Same(int v) {
+	return v;
+}
+
+static inline int Swap16(int v) {
+	return __builtin_bswap16(v);
+}
+
+static inline int Get24(uint8_t *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16);
+}
+
+// framebuffer's order, R first
+static inline int Get888Swapped(uint8_t *p) {
+	return (p[0] << 16) | (p[1] << 8) | p[2];
+}
+
+static inline int Get666Swapped(uint8_t *p) {
+	return (p[0] << 12) | (p[1] << 6) | p[2];
+}
+
+// vertical pages (each byte built from up to 8 rows) or dithered, F is scaled to 8 bits
+#define DRAW_GRAYRGB(T,F)														\
+	int Up = 8 - Scale - Device->Depth;											\
+	if (Device->Depth == 1 && !Device->DrawPixelFast) {							\
+		const uint8_t (*Threshold)[8] = Dithered ? Bayer : NoDither;			\
+		for (int r = 0, Last; r < Height; r = Last + 1) {						\
+			Last = r + 7 - ((r + y) & 7);										\
+			if (Last >= Height) Last = Height - 1;								\
+			uint8_t Mask = (0xff << ((r + y) & 7)) & (0xff >> (7 - ((Last + y) & 7)));	\
+			uint8_t *P = Device->Framebuffer + ((r + y) >> 3) * Device->Width + x;		\
+			for (int c = 0; c < Width; c++) {									\
+				uint8_t Bits = 0;												\
+				for (int k = r; k <= Last; k++) {								\
+					T *S = (T*) (Image + k * Stride + c * Bytes);				\
+					Bits |= (((F(&S) << Up) + Threshold[(k + y) & 7][(c + x) & 7]) >> 8) << ((k + y) & 7);	\
+				}																\
+				*P = (*P & ~Mask) | Bits;										\
+				P++;															\
+			}																	\
+		}																		\
+	} else for (int r = 0; r < Height; r++) {									\
+		T *S = (T*) (Image + r * Stride);										\
+		if (Dithered) {															\
+			const uint8_t *Threshold = Bayer[(r + y) & 7];						\
+			for (int c = 0; c < Width; c++) {									\
+				DrawPixelFast( Device, c + x, r + y, ((F(&S) << Up) * Levels + Threshold[(c + x) & 7]) >> 8);	\
+			}																	\
+		} else if (Scale > 0) {													\
+			for (int c = 0; c < Width; c++) {									\
+				DrawPixelFast( Device, c + x, r + y, F(&S) >> Scale);			\
+			}																	\
+		} else {																\
+			for (int c = 0; c < Width; c++) {									\
+				DrawPixelFast( Device, c + x, r + y, F(&S) << -Scale);			\
+			}																	\
+		}																		\
 	}									
 	
-#define DRAW_RGB(T)										\
-	T *S = (T*) Image;									\
-	for (int r = 0; r < Height; r++) {					\
-		for (int c = 0; c < Width; c++) {				\
-			DrawPixel(Device, c + x, r + y, *S++);	\
-		}												\
+#define DRAW_RGB(T,F)													\
+	for (int r = 0; r < Height; r++) {									\
+		T *S = (T*) (Image + r * Stride);								\
+		for (int c = 0; c < Width; c++) {								\
+			DrawPixelFast(Device, c + x, r + y, F(*S++));				\
+		}																\
 	}																	
 	
-#define DRAW_RGB24													\
-	uint8_t *S = (uint8_t*) Image;									\
-	for (int r = 0; r < Height; r++) {								\
-		for (int c = 0; c < Width; c++) {							\
-			uint32_t v = *S++; v |= *S++ << 8; v |= *S++ << 16;		\
-			DrawPixel(Device, c + x, r + y, v);					\
-		}															\
+#define DRAW_RGB24(F)													\
+	for (int r = 0; r < Height; r++) {									\
+		uint8_t *S = Image + r * Stride;								\
+		for (int c = 0; c < Width; c++, S += 3) {						\
+			DrawPixelFast(Device, c + x, r + y, F(S));					\
+		}																\
 	}	
 
+// rows in framebuffer's format (16 bits are byte-swapped, 24 bits start with R)
+static void CopyRows(struct GDS_Device* Device, uint8_t *Image, int x, int y, int Width, int Height, int Stride, int RGB_Mode, bool Swapped) {
+	int Bytes = ModeBytes(RGB_Mode);
+	
+	for (int r = 0; r < Height; r++) {
+		uint8_t *S = Image + r * Stride, *D = Device->Framebuffer + ((y + r) * Device->Width + x) * Bytes;
+		
+		if (Swapped || Bytes == 1) {
+			memcpy(D, S, Width * Bytes);
+		} else if (Bytes == 2) {
+			uint16_t *S16 = (uint16_t*) S, *D16 = (uint16_t*) D;
+			for (int c = 0; c < Width; c++) *D16++ = __builtin_bswap16(*S16++);
+		} else if (RGB_Mode == GDS_RGB888) {
+			for (int c = 0; c < Width; c++, S += 3) { *D++ = S[2]; *D++ = S[1]; *D++ = S[0]; }
+		} else {
+			for (int c = 0; c < Width; c++, S += 3) {
+				uint32_t v = Get24(S);
+				*D++ = v >> 12; *D++ = (v >> 6) & 0x3f; *D++ = v & 0x3f;
+			}	
+		}
+	}
+}
+
 /****************************************************************************************
- *  Decode the embedded image into pixel lines that can be used with the rest of the logic.
+ *  Draw a bitmap (RGB_Mode can be or'ed with GDS_RGB_SWAPPED). It is clipped once and rows 
+ *  are copied when display has same format and a framebuffer we know about 
  */
 void GDS_DrawRGB( struct GDS_Device* Device, uint8_t *Image, int x, int y, int Width, int Height, int RGB_Mode ) {
+	bool Swapped = RGB_Mode & GDS_RGB_SWAPPED;
 
 	// don't do anything if driver supplies a draw function
 	if (Device->DrawRGB) {
@@ -314,6 +954,24 @@ void GDS_DrawRGB( struct GDS_Device* Device, uint8_t *Image, int x, int y, int W
 		return;
 	}
 	
+	RGB_Mode &= ~GDS_RGB_SWAPPED;
+	int Stride = Width * ModeBytes(RGB_Mode);
+	
+	// clip once for all
+	if (x < 0) {
+		Image -= x * ModeBytes(RGB_Mode);
+		Width += x;
+		x = 0;
+	}
+	if (y < 0) {
+		Image -= y * Stride;
+		Height += y;
+		y = 0;
+	}
+	if (x + Width > Device->Width) Width = Device->Width - x;
+	if (y + Height > Device->Height) Height = Device->Height - y;
+	if (Width <= 0 || Height <= 0) return;
+	
 	// RGB type displays
 	if (Device->Mode > GDS_GRAYSCALE) {
 		// image must match the display mode!
@@ -322,106 +980,221 @@ void GDS_DrawRGB( struct GDS_Device* Device, uint8_t *Image, int x, int y, int W
 			return;
 		}	
 		
-		if (RGB_Mode == GDS_RGB332) {
-			DRAW_RGB(uint8_t);
+		if (!Device->DrawPixelFast && Device->Depth == ModeBytes(RGB_Mode) * 8) {
+			CopyRows(Device, Image, x, y, Width, Height, Stride, RGB_Mode, Swapped);
+		} else if (RGB_Mode == GDS_RGB332) {
+			DRAW_RGB(uint8_t, Same);
 		} else if (RGB_Mode < GDS_RGB666) {
-			DRAW_RGB(uint16_t);
+			if (Swapped) {
+				DRAW_RGB(uint16_t, Swap16);
+			} else {
+				DRAW_RGB(uint16_t, Same);
+			}	
+		} else if (!Swapped) {
+			DRAW_RGB24(Get24);
+		} else if (RGB_Mode == GDS_RGB666) {
+			DRAW_RGB24(Get666Swapped);
 		} else {
-			DRAW_RGB24;
+			DRAW_RGB24(Get888Swapped);
 		}	
 		
 		Device->Dirty = true;
 		return;
 	}
 	
+	// color to grayscale only knows about native order
+	if (Swapped && RGB_Mode > GDS_RGB332) {
+		ESP_LOGE(TAG, "can't convert swapped image mode %u to grayscale", RGB_Mode);
+		return;
+	}
+	
+	int Bytes = ModeBytes(RGB_Mode), Levels = (1 << Device->Depth) - 1;
+	bool Dithered = Dither && Device->Depth < 8;
+	
 	// set the right scaler when displaying grayscale
 	if (RGB_Mode <= GDS_GRAYSCALE) {
 		int Scale = 8 - Device->Depth;
-		DRAW_GRAYRGB(&Image,ToSelf);
+		if (!Device->DrawPixelFast && Device->Depth == 8) {
+			CopyRows(Device, Image, x, y, Width, Height, Stride, RGB_Mode, false);
+		} else {	
+			DRAW_GRAYRGB(uint8_t,ToSelf);
+		}	
 	} else if (RGB_Mode == GDS_RGB332) {
 		int Scale = 3 - Device->Depth;		
-		DRAW_GRAYRGB(&Image,ToGray332);
+		DRAW_GRAYRGB(uint8_t,ToGray332);
 	} else if (RGB_Mode < GDS_RGB666)	{
 		if (RGB_Mode == GDS_RGB565) {
 			int Scale = 6 - Device->Depth;
-			DRAW_GRAYRGB((uint16_t**)&Image,ToGray565);
+			DRAW_GRAYRGB(uint16_t,ToGray565);
 		} else if (RGB_Mode == GDS_RGB555) {
 			int Scale = 5 - Device->Depth;
-			DRAW_GRAYRGB((uint16_t**)&Image,ToGray555);
+			DRAW_GRAYRGB(uint16_t,ToGray555);
 		} else if (RGB_Mode == GDS_RGB444) {
 			int Scale = 4 - Device->Depth; 
-			DRAW_GRAYRGB((uint16_t**)&Image,ToGray444)
+			DRAW_GRAYRGB(uint16_t,ToGray444)
 		}	
 	} else {
 		if (RGB_Mode == GDS_RGB666) {
 			int Scale = 6 - Device->Depth;
-			DRAW_GRAYRGB(&Image,ToGray666);
+			DRAW_GRAYRGB(uint8_t,ToGray666);
 		} else if (RGB_Mode == GDS_RGB888) {
 			int Scale = 8 - Device->Depth;
-			DRAW_GRAYRGB(&Image,ToGray888);
+			DRAW_GRAYRGB(uint8_t,ToGray888);
 		}	
 	} 
 	
 	Device->Dirty = true;	
 }
 
+/****************************************************************************************
+ *  Scale an image in memory to Width x Height at x,y, with nearest or 2x2 box filter, 
+ *  stepping in 16.16. Each destination row is built in a buffer, in image's format, then
+ *  drawn (and converted to display) by GDS_DrawRGB. With nearest, a row is only rebuilt
+ *  when its source row changes. Box averages the 4 pixels around the sampled point, per 
+ *  channel
+ */
+static const uint32_t ChannelMasks[][3] = {
+	{ 0xff, 0, 0 }, { 0xff, 0, 0 },							// GDS_MONO, GDS_GRAYSCALE (8 bits)
+	{ 0xe0, 0x1c, 0x03 }, { 0xf00, 0x0f0, 0x00f },			// GDS_RGB332, GDS_RGB444
+	{ 0x7c00, 0x03e0, 0x001f }, { 0xf800, 0x07e0, 0x001f },	// GDS_RGB555, GDS_RGB565
+	{ 0x3f000, 0xfc0, 0x3f }, { 0xff0000, 0xff00, 0xff },	// GDS_RGB666, GDS_RGB888
+};
+
+static inline uint32_t GetScaled(const uint8_t *p, int Bytes, bool Swapped) {
+	if (Bytes == 1) return *p;
+	if (Bytes == 2) return Swapped ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+	return p[0] | (p[1] << 8) | (p[2] << 16);
+}
+
+static inline void PutScaled(uint8_t *p, int Bytes, bool Swapped, uint32_t v) {
+	if (Bytes == 1) {
+		*p = v;
+	} else if (Bytes == 2) {
+		p[Swapped ? 1 : 0] = v;
+		p[Swapped ? 0 : 1] = v >> 8;
+	} else {
+		p[0] = v; p[1] = v >> 8; p[2] = v >> 16;
+	}	
+}
+
+// rounded average of 4 pixels, channel by channel (swapped 24 bits have one channel per byte)
+static inline uint32_t Average4(const uint32_t *Masks, uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+	uint32_t v = 0;
+	for (int i = 0; i < 3 && Masks[i]; i++) {
+		uint32_t m = Masks[i];
+		v |= (((a & m) + (b & m) + (c & m) + (d & m) + ((m & -m) << 1)) >> 2) & m;
+	}	
+	return v;
+}
+
+void GDS_DrawRGBScaled( struct GDS_Device* Device, uint8_t *Image, int Width, int Height, int RGB_Mode, int x, int y, int DstWidth, int DstHeight, int Filter ) {
+	bool Swapped = RGB_Mode & GDS_RGB_SWAPPED;
+	int Mode = RGB_Mode & ~GDS_RGB_SWAPPED, Bytes = ModeBytes(Mode), Stride = Width * Bytes;
+	
+	if (Width <= 0 || Height <= 0 || DstWidth <= 0 || DstHeight <= 0) return;
+	
+	// same size is just a copy
+	if (Width == DstWidth && Height == DstHeight) {
+		GDS_DrawRGB(Device, Image, x, y, Width, Height, RGB_Mode);
+		return;
+	}	
+	
+	// only visible part is computed
+	int Left = x < 0 ? -x : 0, Right = x + DstWidth > Device->Width ? Device->Width - x : DstWidth;
+	int Top = y < 0 ? -y : 0, Bottom = y + DstHeight > Device->Height ? Device->Height - y : DstHeight;
+	if (Left >= Right || Top >= Bottom) return;
+	
+	uint8_t *Row = malloc((Right - Left) * Bytes);
+	if (!Row) {
+		ESP_LOGE(TAG, "Can't allocate scaling row for %d pixels", Right - Left);
+		return;
+	}	
+	
+	uint32_t XStep = ((uint32_t) Width << 16) / DstWidth, YStep = ((uint32_t) Height << 16) / DstHeight;
+	const uint32_t *Masks = ChannelMasks[Swapped && Bytes == 3 ? GDS_RGB888 : Mode];
+	int Last = -1;
+	
+	for (int r = Top; r < Bottom; r++) {
+		uint32_t YPos = r * YStep + (YStep >> 1);
+		uint8_t *p = Row;
+		
+		if (Filter == GDS_SCALE_BOX) {
+			// top-left of the 2x2 square around sampled point
+			int Y0 = YPos < 0x8000 ? 0 : (YPos - 0x8000) >> 16, Y1 = Y0 + 1 < Height ? Y0 + 1 : Y0;
+			uint8_t *Src0 = Image + Y0 * Stride, *Src1 = Image + Y1 * Stride;
+			uint32_t XPos = Left * XStep + (XStep >> 1);
+			
+			for (int c = Left; c < Right; c++, XPos += XStep, p += Bytes) {
+				int X0 = XPos < 0x8000 ? 0 : (XPos - 0x8000) >> 16, X1 = X0 + 1 < Width ? X0 + 1 : X0;
+				PutScaled(p, Bytes, Swapped, Average4(Masks, GetScaled(Src0 + X0 * Bytes, Bytes, Swapped), GetScaled(Src0 + X1 * Bytes, Bytes, Swapped),
+															 GetScaled(Src1 + X0 * Bytes, Bytes, Swapped), GetScaled(Src1 + X1 * Bytes, Bytes, Swapped)));
+			}
+		} else if ((int) (YPos >> 16) != Last) {
+			uint8_t *Src = Image + (Last = YPos >> 16) * Stride;
+			uint32_t XPos = Left * XStep + (XStep >> 1);
+			
+			for (int c = Left; c < Right; c++, XPos += XStep, p += Bytes) memcpy(p, Src + (XPos >> 16) * Bytes, Bytes);
+		}	
+		
+		GDS_DrawRGB(Device, Row, x + Left, y + r, Right - Left, 1, RGB_Mode);
+	}
+	
+	free(Row);
+}
+
+/****************************************************************************************
+ *  Final size (when fitting) and position of image, returns decoder's 2^N scaling
+ */
+static uint8_t PlaceJPEG(struct GDS_Device* Device, JpegCtx *Context, int Width, int Height, int x, int y, int Fit) {
+	// do we need to fit the image (keep aspect ratio)
+	if (Fit & GDS_IMAGE_FIT) {
+		FitSize(Context, Width, Height, Device->Width - x, Device->Height - y);
+	} else {
+		Context->Width = Width;
+		Context->Height = Height;
+	}	
+	
+	uint8_t N = SetScale(Context, Width, Height);
+		
+	// then place it
+	Context->XOfs = x;
+	Context->YOfs = y;
+	if (Fit & GDS_IMAGE_CENTER_X) Context->XOfs = (Device->Width + x - Context->Width) / 2;
+	else if (Fit & GDS_IMAGE_RIGHT) Context->XOfs = Device->Width - Context->Width;
+	if (Fit & GDS_IMAGE_CENTER_Y) Context->YOfs = (Device->Height + y - Context->Height) / 2;
+	else if (Fit & GDS_IMAGE_BOTTOM) Context->YOfs = Device->Height - Context->Height;
+
+	Context->XMin = x - Context->XOfs;
+	Context->YMin = y - Context->YOfs;
+
+	return N;
+}
+
 /****************************************************************************************
  *  Decode the embedded image into pixel lines that can be used with the rest of the logic.
  */
-bool GDS_DrawJPEG(struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit) {
+static bool DrawJPEG(struct GDS_JpegDecoder *Owner, struct GDS_Device* Device, JpegCtx *Input, int x, int y, int Fit) {
     JDEC Decoder;
-    JpegCtx Context;
+    JpegCtx Context = *Input;
 	bool Ret = false;
-	char *Scratch = calloc(SCRATCH_SIZE, 1);
+	char *Scratch = AcquireScratch(Owner);
 	
-    if (!Scratch) {
-        ESP_LOGE(TAG, "Cannot allocate workspace");
-        return NULL;
-    }
+    if (!Scratch) return false;
 
     // Populate fields of the JpegCtx struct.
-    Context.InData = Source;
-    Context.InPos = 0;
-	Context.XOfs = x;
-	Context.YOfs = y;
 	Context.Device = Device;
 	Context.Depth = Device->Depth;
         
     //Prepare and decode the jpeg.
     int Res = jd_prepare(&Decoder, InHandler, Scratch, SCRATCH_SIZE, (void*) &Context);
-	Context.Width = Decoder.width;
-	Context.Height = Decoder.height;
 	
     if (Res == JDR_OK) {
-		uint8_t N = 0;
-		
-		// do we need to fit the image
-		if (Fit & GDS_IMAGE_FIT) {
-			float XRatio = (Device->Width - x) / (float) Decoder.width, YRatio = (Device->Height - y) / (float) Decoder.height;
-			uint8_t Ratio = XRatio < YRatio ? ceil(1/XRatio) : ceil(1/YRatio);
-			Ratio--; Ratio |= Ratio >> 1; Ratio |= Ratio >> 2; Ratio++;
-			while (Ratio >>= 1) N++;
-			if (N > 3) {
-				ESP_LOGW(TAG, "Image will not fit %dx%d", Decoder.width, Decoder.height);
-				N = 3;
-			}	
-			Context.Width /= 1 << N;
-			Context.Height /= 1 << N;
-		} 
-		
-		// then place it
-		if (Fit & GDS_IMAGE_CENTER_X) Context.XOfs = (Device->Width + x - Context.Width) / 2;
-		else if (Fit & GDS_IMAGE_RIGHT) Context.XOfs = Device->Width - Context.Width;
-		if (Fit & GDS_IMAGE_CENTER_Y) Context.YOfs = (Device->Height + y - Context.Height) / 2;
-		else if (Fit & GDS_IMAGE_BOTTOM) Context.YOfs = Device->Height - Context.Height;
-
-		Context.XMin = x - Context.XOfs;
-		Context.YMin = y - Context.YOfs;
-		Context.Mode = Device->Mode;
+		uint8_t N = PlaceJPEG(Device, &Context, Decoder.width, Decoder.height, x, y, Fit);
+		SetFormat(&Decoder, &Context, Device->Mode);
 					
-		// do decompress & draw
+		// do decompress & draw (interrupted means we are past the bottom of the screen)
 		Res = jd_decomp(&Decoder, OutHandlerDirect, N);
-		if (Res == JDR_OK) {
+		if (Res == JDR_OK || Res == JDR_INTR) {
 			Device->Dirty = true;
 			Ret = true;
 		} else {	
@@ -431,8 +1204,1565 @@ bool GDS_DrawJPEG(struct GDS_Device* Device, uint8_t *Source, int x, int y, int
         ESP_LOGE(TAG, "Image decoder: jd_prepare failed (%d)", Res);
     }    
       
-	// free scratch area
-    if (Scratch) free(Scratch);
+	ReleaseScratch(Owner, Scratch);
 	return Ret;
 }
 
+/****************************************************************************************
+ *  Cache of decoded images, already in device's format. Key is the source (address, size 
+ *  when known and a hash of headers and beginning of scan, which the decoder reads anyway), 
+ *  the final size and the mode. Least recently used images are evicted when budget is exceeded. 
+ */
+#define KEY_SCAN	256
+
+typedef struct CacheEntry {
+	struct CacheEntry *Next;
+	const uint8_t *Source;
+	size_t InSize;				// as given by caller, 0 if unknown
+	uint32_t Hash;
+	uint8_t Mode;
+	int Width, Height;
+	size_t Size;
+	uint8_t *Data;
+} CacheEntry;
+
+typedef struct {
+	uint32_t Head;				// headers and beginning of scan
+	uint32_t Length, Content;	// whole JPEG, for the store (Length is 0 when EOI is not in range)
+	bool Whole;					// Length and Content are set
+} JpegKey;
+
+static struct {
+	pthread_mutex_t Mutex;		// list (held while drawing a hit)
+	size_t Budget, Used;
+	CacheEntry *Head;
+} Cache = { .Mutex = PTHREAD_MUTEX_INITIALIZER };
+
+static uint32_t Hash(const uint8_t *Data, int Len) {
+	uint32_t Hash = 2166136261;
+	while (Len--) Hash = (Hash ^ *Data++) * 16777619;
+	return Hash;
+}
+
+// Scan is where entropy coded data starts, nothing is read beyond Limit
+static uint32_t HeadHash(const uint8_t *Data, int Scan, size_t Limit) {
+	size_t Len = Scan + KEY_SCAN < Limit ? Scan + KEY_SCAN : Limit, End = JpegLength(Data, Len);
+	return Hash(Data, End ? End : Len);
+}
+
+static void CacheEvict(size_t Budget) {
+	while (Cache.Used > Budget) {
+		CacheEntry **Last = &Cache.Head;
+		while ((*Last)->Next) Last = &(*Last)->Next;
+		Cache.Used -= (*Last)->Size;
+		free((*Last)->Data);
+		free(*Last);
+		*Last = NULL;
+	}	
+}
+
+// blit a bitmap in device's format, but respect clipping requested by placement
+static void DrawPlaced(struct GDS_Device* Device, JpegCtx *Context, uint8_t *Data) {
+	int Bytes = ModeBytes(Device->Mode), XMin = Context->XMin > 0 ? Context->XMin : 0;
+	for (int r = Context->YMin > 0 ? Context->YMin : 0; r < Context->Height && XMin < Context->Width; r++) {
+		GDS_DrawRGB(Device, Data + (r * Context->Width + XMin) * Bytes, Context->XOfs + XMin, Context->YOfs + r, Context->Width - XMin, 1, Device->Mode);
+	}	
+}
+
+// returns the link to the entry (placement must be done), NULL if not found. Caller holds Cache.Mutex
+static CacheEntry** CacheFind(JpegCtx *Context, uint32_t Key, uint8_t Mode) {
+	for (CacheEntry **Prev = &Cache.Head; *Prev; Prev = &(*Prev)->Next) {
+		CacheEntry *Entry = *Prev;
+		if (Entry->Source == Context->InData && Entry->InSize == Context->InSize && Entry->Hash == Key && Entry->Width == Context->Width && 
+			Entry->Height == Context->Height && Entry->Mode == Mode) {
+			return Prev;
+		}	
+	}
+	return NULL;
+}
+
+static bool CacheHas(JpegCtx *Context, uint32_t Key, uint8_t Mode) {
+	pthread_mutex_lock(&Cache.Mutex);
+	bool Found = CacheFind(Context, Key, Mode) != NULL;
+	pthread_mutex_unlock(&Cache.Mutex);
+	return Found;
+}
+
+/****************************************************************************************
+ *  Persistent store of decoded images in a data partition (a file on host) that survives
+ *  reboots. Key is the length and a hash of the whole JPEG, the final size and the mode. 
+ *  Entries are appended like a log, pixels first and header last so that an interrupted 
+ *  write is never indexed. When full, it wraps over and oldest entries are erased, so at
+ *  boot all of it is scanned and writing resumes after the newest entry. Hits
+ *  are drawn straight from the memory-mapped store. Flash is written by a low priority 
+ *  task once the image has been drawn, one image at a time.
+ */
+#define STORE_MAGIC		0x45534447		// "GDSE"
+#define STORE_SECTOR	4096
+#define STORE_PRIORITY	1
+#define STORE_MAX_JPEG	(512 * 1024)
+
+typedef struct {
+	uint32_t Magic, Sequence, Key, Length;
+	uint16_t Width, Height;
+	uint8_t Mode, Reserved[3];
+	uint32_t Size;
+	uint32_t Check;			// hash of the above
+} StoreHeader;
+
+typedef struct {
+	uint32_t Key, Length, Offset, Size;
+	uint16_t Width, Height;
+	uint8_t Mode;
+} StoreEntry;
+
+typedef struct {
+	uint32_t Key, Length, Size;
+	uint16_t Width, Height;
+	uint8_t Mode;
+	uint8_t *Data;			// set while pending or being written
+} StoreJob;
+
+static struct {
+	pthread_t Thread;
+	pthread_mutex_t Mutex;	// index, head and job (held while drawing a hit)
+	pthread_cond_t Cond;
+	bool Running;
+	StoreJob Job;
+#ifdef ESP_PLATFORM
+	const esp_partition_t *Partition;
+	spi_flash_mmap_handle_t Handle;
+#else
+	int fd;
+#endif
+	const uint8_t *Data;
+	uint32_t Size;
+	uint32_t Head;			// where next entry goes, erased up to next sector
+	uint32_t Sequence;		// of next entry
+	int Count, Max;
+	StoreEntry *Index;
+} Store = { .Mutex = PTHREAD_MUTEX_INITIALIZER, .Cond = PTHREAD_COND_INITIALIZER };
+
+// whole entry, keeping headers aligned
+static inline uint32_t StoreLen(uint32_t Size) {
+	return (sizeof(StoreHeader) + Size + 3) & ~3;
+}
+
+static bool StoreWrite(uint32_t Offset, const void *Data, size_t Len) {
+#ifdef ESP_PLATFORM
+	return esp_partition_write(Store.Partition, Offset, Data, Len) == ESP_OK;
+#else
+	return pwrite(Store.fd, Data, Len, Offset) == (ssize_t) Len;
+#endif
+}
+
+static bool StoreErase(uint32_t Offset, size_t Len) {
+#ifdef ESP_PLATFORM
+	return esp_partition_erase_range(Store.Partition, Offset, Len) == ESP_OK;
+#else
+	uint8_t Blank[STORE_SECTOR];
+	memset(Blank, 0xff, sizeof(Blank));
+	for (size_t i = 0; i < Len; i += STORE_SECTOR) if (!StoreWrite(Offset + i, Blank, STORE_SECTOR)) return false;
+	return true;
+#endif
+}
+
+// pixels in rest of the store might match the magic, hence the check
+static bool StoreValid(uint32_t Offset, const StoreHeader *Header) {
+	return Header->Magic == STORE_MAGIC && Header->Check == Hash((const uint8_t*) Header, offsetof(StoreHeader, Check)) &&
+		   Header->Size < Store.Size && Offset + StoreLen(Header->Size) <= Store.Size;
+}
+
+static void StoreIndex(uint32_t Offset, const StoreHeader *Header) {
+	if (Store.Count == Store.Max) {
+		StoreEntry *Index = realloc(Store.Index, (Store.Max + 16) * sizeof(StoreEntry));
+		if (!Index) return;
+		Store.Index = Index;
+		Store.Max += 16;
+	}	
+	Store.Index[Store.Count++] = (StoreEntry) { .Key = Header->Key, .Length = Header->Length, .Offset = Offset, .Size = Header->Size,
+												.Width = Header->Width, .Height = Header->Height, .Mode = Header->Mode };
+}
+
+// caller holds Store.Mutex, pixels are valid until it's released
+static const uint8_t* StoreFind(JpegCtx *Context, uint32_t Key, uint32_t Length, uint8_t Mode) {
+	for (int i = 0; i < Store.Count; i++) {
+		StoreEntry *Entry = Store.Index + i;
+		if (Entry->Key == Key && Entry->Length == Length && Entry->Width == Context->Width && 
+			Entry->Height == Context->Height && Entry->Mode == Mode) {
+			return Store.Data + Entry->Offset + sizeof(StoreHeader);
+		}	
+	}
+	return NULL;
+}
+
+// store's key is the whole JPEG, false when its EOI is not within reach (never stored then)
+static bool StoreKey(JpegKey *Key, JpegCtx *Context) {
+	if (!Key->Whole) {
+		Key->Length = JpegLength(Context->InData, Context->InSize ? Context->InSize : STORE_MAX_JPEG);
+		Key->Content = Key->Length ? Hash(Context->InData, Key->Length) : 0;
+		Key->Whole = true;
+	}	
+	return Key->Length != 0;
+}
+
+static bool StoreHas(JpegCtx *Context, uint32_t Key, uint32_t Length, uint8_t Mode) {
+	if (!Store.Data) return false;
+	pthread_mutex_lock(&Store.Mutex);
+	bool Found = StoreFind(Context, Key, Length, Mode) != NULL;
+	pthread_mutex_unlock(&Store.Mutex);
+	return Found;
+}
+
+// hand a decoded image to the writer, which owns Data afterwards (unless Copy is set)
+static void StoreAdd(uint32_t Key, uint32_t Length, uint8_t Mode, int Width, int Height, uint8_t *Data, uint32_t Size, bool Copy) {
+	bool Taken = false;
+	
+	pthread_mutex_lock(&Store.Mutex);
+	
+	// one at a time and don't let one image flush the whole store (others will be added next time they are drawn)
+	if (Store.Running && !Store.Job.Data && StoreLen(Size) <= Store.Size / 2) {
+		uint8_t *Pixels = Copy ? malloc(Size) : Data;
+		if (Pixels) {
+			if (Copy) memcpy(Pixels, Data, Size);
+			Store.Job = (StoreJob) { .Key = Key, .Length = Length, .Size = Size, .Width = Width, .Height = Height, 
+									 .Mode = Mode, .Data = Pixels };
+			pthread_cond_broadcast(&Store.Cond);
+			Taken = true;
+		}
+	}	
+	
+	pthread_mutex_unlock(&Store.Mutex);
+	if (!Taken && !Copy) free(Data);
+}
+
+static void *StoreWriter(void *Arg) {
+	pthread_mutex_lock(&Store.Mutex);
+	
+	while (1) {
+		while (!Store.Job.Data) pthread_cond_wait(&Store.Cond, &Store.Mutex);
+		
+		StoreJob *Job = &Store.Job;
+		uint32_t Len = StoreLen(Job->Size);
+		if (Store.Head + Len > Store.Size) Store.Head = 0;
+		uint32_t Offset = Store.Head;
+		
+		// erase sectors not yet erased and forget entries that were there (hits are drawn under lock so none is in use)
+		uint32_t Erased = Offset & (STORE_SECTOR - 1) ? (Offset + STORE_SECTOR - 1) & ~(STORE_SECTOR - 1) : Offset;
+		uint32_t End = (Offset + Len + STORE_SECTOR - 1) & ~(STORE_SECTOR - 1);
+		if (End > Store.Size) End = Store.Size;
+		
+		for (int i = 0; i < Store.Count; i++) {
+			StoreEntry *Entry = Store.Index + i;
+			if (Entry->Offset < End && Entry->Offset + StoreLen(Entry->Size) > Offset) Store.Index[i--] = Store.Index[--Store.Count];
+		}	
+		
+		Store.Head += Len;
+		StoreHeader Header = { .Magic = STORE_MAGIC, .Sequence = Store.Sequence++, .Key = Job->Key, .Length = Job->Length, 
+							   .Width = Job->Width, .Height = Job->Height, .Mode = Job->Mode, .Size = Job->Size };
+		Header.Check = Hash((const uint8_t*) &Header, offsetof(StoreHeader, Check));
+		pthread_mutex_unlock(&Store.Mutex);
+		
+		// flash is slow, don't hold the lock meanwhile
+		bool Written = (End <= Erased || StoreErase(Erased, End - Erased)) && 
+					   StoreWrite(Offset + sizeof(StoreHeader), Job->Data, Job->Size) && StoreWrite(Offset, &Header, sizeof(Header));
+		
+		pthread_mutex_lock(&Store.Mutex);
+		
+		if (Written) {
+			StoreIndex(Offset, &Header);
+		} else {
+			ESP_LOGE(TAG, "Can't write %u bytes in image store at %u", Job->Size, Offset);
+			// don't know what's left there
+			Store.Head = End < Store.Size ? End : 0;
+		}	
+		
+		free(Job->Data);
+		Job->Data = NULL;
+		pthread_cond_broadcast(&Store.Cond);
+	}
+	
+	return NULL;
+}
+
+bool GDS_ImageStoreInit(const char *Name) {
+	const void *Map;
+	
+	if (Store.Data) return true;
+	
+#ifdef ESP_PLATFORM
+	Store.Partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, Name);
+	
+	if (!Store.Partition || Store.Partition->size < 2 * STORE_SECTOR ||
+		esp_partition_mmap(Store.Partition, 0, Store.Partition->size, SPI_FLASH_MMAP_DATA, &Map, &Store.Handle) != ESP_OK) {
+		ESP_LOGE(TAG, "can't map image store partition %s", Name ? Name : "");
+		return false;
+	}
+	
+	Store.Size = Store.Partition->size;
+#else
+	struct stat Stat;
+	
+	// file must be created with the store size
+	if ((Store.fd = open(Name, O_RDWR)) < 0 || fstat(Store.fd, &Stat) || Stat.st_size < 2 * STORE_SECTOR ||
+		(Map = mmap(NULL, Stat.st_size & ~(STORE_SECTOR - 1), PROT_READ, MAP_SHARED, Store.fd, 0)) == MAP_FAILED) {
+		ESP_LOGE(TAG, "can't map image store file %s", Name ? Name : "");
+		if (Store.fd >= 0) close(Store.fd);
+		return false;
+	}
+	
+	Store.Size = Stat.st_size & ~(STORE_SECTOR - 1);
+#endif
+
+	pthread_mutex_lock(&Store.Mutex);
+	Store.Data = Map;
+	
+	// once wrapped, older entries follow newest ones after a gap (erased space, leftovers of 
+	// overwritten entries or of an interrupted write) so every aligned offset is a candidate
+	const StoreHeader *Newest = NULL;
+	for (uint32_t Offset = 0; Offset + sizeof(StoreHeader) <= Store.Size; ) {
+		const StoreHeader *Header = (const StoreHeader*) (Store.Data + Offset);
+		if (!StoreValid(Offset, Header)) {
+			Offset += 4;
+			continue;
+		}	
+		StoreIndex(Offset, Header);
+		if (!Newest || (int32_t) (Header->Sequence - Newest->Sequence) > 0) Newest = Header;
+		Offset += StoreLen(Header->Size);
+	}
+	
+	// continue after newest entry
+	Store.Head = Newest ? (const uint8_t*) Newest - Store.Data + StoreLen(Newest->Size) : 0;
+	Store.Sequence = Newest ? Newest->Sequence + 1 : 0;
+	
+	// an interrupted write might have left something behind
+	for (uint32_t i = Store.Head; i < Store.Size && (i & (STORE_SECTOR - 1)); i++) {
+		if (Store.Data[i] == 0xff) continue;
+		Store.Head = (Store.Head + STORE_SECTOR - 1) & ~(STORE_SECTOR - 1);
+		break;
+	}	
+	
+	pthread_mutex_unlock(&Store.Mutex);
+	
+	ESP_LOGI(TAG, "image store %s has %d images (%u/%u bytes)", Name, Store.Count, Store.Head, Store.Size);
+	
+	// low priority so that flash writes never get in the way of display or audio
+	if (!Store.Running) Store.Running = StartThread(&Store.Thread, StoreWriter, NULL, -1, STORE_PRIORITY, "gds_store");
+	return true;
+}
+
+void GDS_ImageStoreErase(void) {
+	if (!Store.Data) return;
+	
+	pthread_mutex_lock(&Store.Mutex);
+	
+	// let pending write complete first
+	while (Store.Job.Data) pthread_cond_wait(&Store.Cond, &Store.Mutex);
+	
+	StoreErase(0, Store.Size);
+	Store.Count = 0;
+	Store.Head = 0;
+	pthread_mutex_unlock(&Store.Mutex);
+}
+
+// Key is computed when not provided
+static bool DrawJPEGCached(struct GDS_JpegDecoder *Owner, struct GDS_Device* Device, JpegCtx *Context, int x, int y, int Fit, JpegKey *Key) {
+	size_t Limit = Context->InSize ? Context->InSize : SIZE_MAX;
+	int Width, Height, Scan = ProbeJPEG(Context->InData, Limit, &Width, &Height);
+	
+	// let the decoder sort out what it does not like
+	if (!Scan) return DrawJPEG(Owner, Device, Context, x, y, Fit);
+
+	PlaceJPEG(Device, Context, Width, Height, x, y, Fit);
+	JpegKey Computed;
+	if (!Key) {
+		Computed = (JpegKey) { .Head = HeadHash(Context->InData, Scan, Limit) };
+		Key = &Computed;
+	}	
+
+	// hits are drawn under lock so that nobody evicts them meanwhile
+	if (Cache.Budget) {
+		pthread_mutex_lock(&Cache.Mutex);
+		CacheEntry **Prev = CacheFind(Context, Key->Head, Device->Mode), *Entry = Prev ? *Prev : NULL;
+		if (Entry) {
+			// most recent goes first
+			*Prev = Entry->Next;
+			Entry->Next = Cache.Head;
+			Cache.Head = Entry;
+			DrawPlaced(Device, Context, Entry->Data);
+		}	
+		pthread_mutex_unlock(&Cache.Mutex);
+		if (Entry) return true;
+	}
+	
+	if (Store.Data && StoreKey(Key, Context)) {
+		// in persistent store, no need to copy it in RAM (lock prevents writer from erasing it meanwhile)
+		pthread_mutex_lock(&Store.Mutex);
+		const uint8_t *Stored = StoreFind(Context, Key->Content, Key->Length, Device->Mode);
+		if (Stored) DrawPlaced(Device, Context, (uint8_t*) Stored);
+		pthread_mutex_unlock(&Store.Mutex);
+		if (Stored) return true;
+	}	
+
+	// not cached, decode it in device's format and draw it before it's shared
+	uint8_t *Data = DecodeJPEG(Owner, Context, &Width, &Height, 1, Device->Mode);
+	size_t Size = Width * Height * ModeBytes(Device->Mode);
+	if (!Data) return false;
+	
+	DrawPlaced(Device, Context, Data);
+	CacheEntry *Entry = Size <= Cache.Budget ? malloc(sizeof(CacheEntry)) : NULL;
+	
+	// store it only now that it's on display, writer needs its own copy when cached
+	if (Key->Length) StoreAdd(Key->Content, Key->Length, Device->Mode, Width, Height, Data, Size, Entry != NULL);
+	else if (!Entry) free(Data);
+	
+	if (Entry) {
+		*Entry = (CacheEntry) { .Source = Context->InData, .InSize = Context->InSize, .Hash = Key->Head, .Mode = Device->Mode, 
+								.Width = Width, .Height = Height, .Size = Size, .Data = Data };
+		pthread_mutex_lock(&Cache.Mutex);
+		
+		// budget might have changed since
+		if (Size <= Cache.Budget) {
+			CacheEvict(Cache.Budget - Size);
+			Entry->Next = Cache.Head;
+			Cache.Head = Entry;
+			Cache.Used += Size;
+		} else {
+			free(Data);
+			free(Entry);
+		}	
+		
+		pthread_mutex_unlock(&Cache.Mutex);
+	}	
+
+	return true;
+}
+
+void GDS_ImageCacheSetBudget(size_t Bytes) {
+	pthread_mutex_lock(&Cache.Mutex);
+	CacheEvict(Bytes);
+	Cache.Budget = Bytes;
+	pthread_mutex_unlock(&Cache.Mutex);
+}
+
+void GDS_ImageCacheFlush(void) {
+	pthread_mutex_lock(&Cache.Mutex);
+	CacheEvict(0);
+	pthread_mutex_unlock(&Cache.Mutex);
+}
+
+bool GDS_DrawJPEG(struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit) {
+	JpegCtx Context = { .InData = Source };
+	if (Cache.Budget || Store.Data) return DrawJPEGCached(NULL, Device, &Context, x, y, Fit, NULL);
+	return DrawJPEG(NULL, Device, &Context, x, y, Fit);
+}
+
+bool GDS_DrawJPEGSized(struct GDS_Device* Device, uint8_t *Source, size_t Size, int x, int y, int Fit) {
+	JpegCtx Context = { .InData = Source, .InSize = Size };
+	if (Cache.Budget || Store.Data) return DrawJPEGCached(NULL, Device, &Context, x, y, Fit, NULL);
+	return DrawJPEG(NULL, Device, &Context, x, y, Fit);
+}
+
+bool GDS_JpegDecoderDraw(struct GDS_JpegDecoder *Decoder, struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit) {
+	JpegCtx Context = { .InData = Source };
+	if (Cache.Budget || Store.Data) return DrawJPEGCached(Decoder, Device, &Context, x, y, Fit, NULL);
+	return DrawJPEG(Decoder, Device, &Context, x, y, Fit);
+}
+
+bool GDS_DrawJPEGStream(struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit) {
+	JpegCtx Context = { .Read = Read, .Handle = Handle };
+	return DrawJPEG(NULL, Device, &Context, x, y, Fit);
+}
+
+/****************************************************************************************
+ *  Decode at 1/8 (cheapest decoder's path), stretch it to final placement and update 
+ *  display, then draw the full image over it
+ */
+bool GDS_DrawJPEGProgressive(struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit) {
+	JpegCtx Context = { .InData = Source }, Preview = { .InData = Source }, Full = { .InData = Source };
+	int Width, Height, Scan = ProbeJPEG(Source, SIZE_MAX, &Width, &Height);
+	bool Cached = Scan && (Cache.Budget || Store.Data);
+	JpegKey Key = { .Head = Cached ? HeadHash(Source, Scan, SIZE_MAX) : 0 };
+	
+	// no preview when full image is already decoded at 1/8 or when it is cached (key is computed once)
+	if (!Scan || PlaceJPEG(Device, &Context, Width, Height, x, y, Fit) == 3 ||
+		(Cached && Cache.Budget && CacheHas(&Context, Key.Head, Device->Mode)) || 
+		(Cached && Store.Data && StoreKey(&Key, &Context) && StoreHas(&Context, Key.Content, Key.Length, Device->Mode))) {
+		return Cached ? DrawJPEGCached(NULL, Device, &Full, x, y, Fit, &Key) : DrawJPEG(NULL, Device, &Full, x, y, Fit);
+	}	
+	
+	Preview.Width = Width >> 3;
+	Preview.Height = Height >> 3;
+	
+	int Bytes = ModeBytes(Device->Mode);
+	uint8_t *Data = DecodeJPEG(NULL, &Preview, &Width, &Height, 1, Device->Mode);
+	uint8_t *Row = malloc(Context.Width * Bytes);
+	
+	// nearest neighbour upscaling, one row at a time (only rebuilt when source row changes)
+	if (Data && Row) {
+		int XStep = (Width << 16) / Context.Width, YStep = (Height << 16) / Context.Height;
+		int XMin = Context.XMin > 0 ? Context.XMin : 0, Last = -1;
+		
+		for (int r = Context.YMin > 0 ? Context.YMin : 0; r < Context.Height && r + Context.YOfs < Device->Height && XMin < Context.Width; r++) {
+			int Src = (r * YStep) >> 16;
+			if (Src != Last) {
+				uint8_t *Pixels = Data + Src * Width * Bytes;
+				for (int c = XMin; c < Context.Width; c++) memcpy(Row + c * Bytes, Pixels + ((c * XStep) >> 16) * Bytes, Bytes);
+				Last = Src;
+			}	
+			GDS_DrawRGB(Device, Row + XMin * Bytes, Context.XOfs + XMin, Context.YOfs + r, Context.Width - XMin, 1, Device->Mode);
+		}	
+		
+		GDS_Update(Device);
+	}	
+	
+	free(Row);
+	free(Data);
+	
+	return Cached ? DrawJPEGCached(NULL, Device, &Full, x, y, Fit, &Key) : DrawJPEG(NULL, Device, &Full, x, y, Fit);
+}
+
+/****************************************************************************************
+ *  Native images are pre-converted (see tools/gdsimage.py) rows of pixels laid out like
+ *  the framebuffer, so they can be copied when display matches. 16 bytes header, little
+ *  endian, followed by palette (if any) and pixels
+ *	[0..3]	"GDSI"
+ *	[4]		version (1)
+ *	[5]		mode (GDS_MONO ... GDS_RGB888)
+ *	[6]		depth (1, 4, 8, 16 or 24 bits per pixel)
+ *	[7]		flags (0x01 = RLE, 0x02 = palette)
+ *	[8..9]	width, [10..11] height, [12..13] palette entries, [14..15] reserved
+ *  Rows are byte aligned. 1 and 4 bits pixels are packed with left one in LSB, 16 bits are
+ *  big endian and 24 bits are R,G,B bytes (6 bits each for RGB666). With a palette, pixels
+ *  are 8 bits indexes of entries in the above format (8 bits depth and above). With RLE, 
+ *  rows are made of runs starting with a control byte c followed by one unit repeated 
+ *  (c & 0x7f) + 1 times if c & 0x80, or else c + 1 units. A unit is a byte for palette or 
+ *  less than 8 bits depth, a pixel otherwise. Runs never span across rows.
+ */
+#define IMAGE_HEADER_SIZE	16
+#define IMAGE_VERSION		1
+#define IMAGE_RLE			0x01
+#define IMAGE_PALETTE		0x02
+
+typedef struct {
+	uint8_t Mode, Depth, Flags;
+	int Width, Height, Entries;
+	const uint8_t *Palette, *Data;
+} NativeImage;
+
+static bool ParseImage(const uint8_t *Image, NativeImage *Native) {
+	if (!Image || memcmp(Image, "GDSI", 4) || Image[4] != IMAGE_VERSION) return false;
+	
+	Native->Mode = Image[5];
+	Native->Depth = Image[6];
+	Native->Flags = Image[7];
+	Native->Width = Image[8] | (Image[9] << 8);
+	Native->Height = Image[10] | (Image[11] << 8);
+	Native->Entries = Image[12] | (Image[13] << 8);
+	Native->Palette = Image + IMAGE_HEADER_SIZE;
+	Native->Data = Native->Palette + Native->Entries * (Native->Depth / 8);
+	
+	// depth must be consistent with mode
+	if (Native->Mode <= GDS_GRAYSCALE) {
+		if (Native->Depth != 1 && Native->Depth != 4 && Native->Depth != 8) return false;
+	} else if (Native->Depth != ModeBytes(Native->Mode) * 8) {
+		return false;
+	}
+	
+	if (Native->Flags & IMAGE_PALETTE) {
+		if (Native->Depth < 8 || !Native->Entries || Native->Entries > 256) return false;
+	} else if (Native->Entries) {
+		return false;
+	}
+	
+	return Native->Width && Native->Height;
+}
+
+// expand one RLE row of Len units (of Unit bytes), returns where next row starts
+static const uint8_t* UnpackRLE(const uint8_t *Data, uint8_t *Row, int Len, int Unit) {
+	while (Len > 0) {
+		int Count = (*Data & 0x7f) + 1;
+		if (Count > Len) Count = Len;
+		if (*Data++ & 0x80) {
+			for (int i = 0; i < Count; i++, Row += Unit) memcpy(Row, Data, Unit);
+			Data += Unit;
+		} else {
+			memcpy(Row, Data, Count * Unit);
+			Row += Count * Unit;
+			Data += Count * Unit;
+		}
+		Len -= Count;
+	}
+	return Data;
+}
+
+static inline int GetNativePixel(NativeImage *Native, const uint8_t *Row, int c) {
+	switch (Native->Depth) {
+	case 1: return (Row[c >> 3] >> (c & 0x07)) & 0x01;
+	case 4: return (Row[c >> 1] >> ((c & 0x01) << 2)) & 0x0f;
+	case 8: return Row[c];
+	case 16: return (Row[c * 2] << 8) | Row[c * 2 + 1];
+	default: 
+		Row += c * 3;
+		if (Native->Mode == GDS_RGB666) return (Row[0] << 12) | (Row[1] << 6) | Row[2];
+		return (Row[0] << 16) | (Row[1] << 8) | Row[2];
+	}	
+}
+
+bool GDS_GetImageSize(const uint8_t *Image, int *Width, int *Height) {
+	NativeImage Native;
+	
+	if (!ParseImage(Image, &Native)) return false;
+	*Width = Native.Width;
+	*Height = Native.Height;
+	return true;
+}
+
+// row buffers needed by RLE and palette (packed and unpacked), for up to Width pixels
+static size_t NativeBufferSize(NativeImage *Native, int Width) {
+	int Bytes = Native->Depth / 8, Unit = Native->Flags & IMAGE_PALETTE || !Bytes ? 1 : Bytes;
+	int Len = Native->Depth < 8 ? (Width * Native->Depth + 7) / 8 : Width;
+	
+	if (!(Native->Flags & (IMAGE_RLE | IMAGE_PALETTE))) return 0;
+	return Len * Unit + (Native->Flags & IMAGE_PALETTE ? Width * Bytes : 0);
+}
+
+/****************************************************************************************
+ *  Blit the Left..Right x Top..Bottom part of a native image (excluded) into framebuffer
+ *  at X,Y. Rows are copied as-is when display has the same layout, otherwise drawn pixel 
+ *  by pixel. Drawn area is invalidated
+ */
+static void BlitNative(struct GDS_Device* Device, NativeImage *Native, int X, int Y, int Left, int Top, int Right, int Bottom, uint8_t *Buffer) {
+	int Bytes = Native->Depth / 8, Unit = Native->Flags & IMAGE_PALETTE || !Bytes ? 1 : Bytes;
+	int Len = Native->Depth < 8 ? (Native->Width * Native->Depth + 7) / 8 : Native->Width;
+	const uint8_t *Data = Native->Data;
+	
+	// same layout as framebuffer (4 bits needs even position, 1 bit has vertical pages)
+	bool Copy = !Device->DrawPixelFast && Native->Depth == Device->Depth && Native->Depth != 1 && 
+				(Native->Depth != 4 || !(X & 0x01));
+	int Shift = Native->Mode <= GDS_GRAYSCALE ? Native->Depth - Device->Depth : 0;
+	
+	for (int r = 0; r < Bottom; r++) {
+		const uint8_t *Row = Data;
+		
+		if (Native->Flags & IMAGE_RLE) {
+			Data = UnpackRLE(Data, Buffer, Len, Unit);
+			Row = Buffer;
+		} else {
+			Data += Len * Unit;
+		}
+		
+		if (r < Top) continue;
+		
+		if (Native->Flags & IMAGE_PALETTE) {
+			uint8_t *Pixels = Buffer + Len;
+			for (int c = Left; c < Right; c++) memcpy(Pixels + c * Bytes, Native->Palette + Row[c] * Bytes, Bytes);
+			Row = Pixels;
+		}
+		
+		int Yr = Y + r;
+		
+		if (Copy && Bytes) {
+			memcpy(Device->Framebuffer + (Yr * Device->Width + X + Left) * Bytes, Row + Left * Bytes, (Right - Left) * Bytes);
+		} else if (Copy) {
+			// 4 bits at even position, only first and last pixels might not be a full byte
+			int Even = (Left + 1) & ~0x01;
+			if (Left & 0x01) DrawPixel4Fast(Device, X + Left, Yr, GetNativePixel(Native, Row, Left));
+			memcpy(Device->Framebuffer + ((Yr * Device->Width + X + Even) >> 1), Row + (Even >> 1), (Right - Even) >> 1);
+			if ((Right - Even) & 0x01) DrawPixel4Fast(Device, X + Right - 1, Yr, GetNativePixel(Native, Row, Right - 1));
+		} else {
+			for (int c = Left; c < Right; c++) {
+				int Color = GetNativePixel(Native, Row, c);
+				if (Shift > 0) Color >>= Shift;
+				else if (Shift < 0) Color = Color * ((1 << Device->Depth) - 1) / ((1 << Native->Depth) - 1);
+				DrawPixelFast(Device, X + c, Yr, Color);
+			}
+		}	
+	}
+	
+	GDS_Invalidate(Device, X + Left, Y + Top, X + Right - 1, Y + Bottom - 1);
+}
+
+// color images must match display, grayscale ones can be rescaled to any grayscale depth
+static bool NativeMatch(struct GDS_Device* Device, NativeImage *Native) {
+	if (Native->Mode > GDS_GRAYSCALE ? Native->Mode != Device->Mode : Device->Mode > GDS_GRAYSCALE) {
+		ESP_LOGE(TAG, "non-matching display & image mode %u %u", Device->Mode, Native->Mode);
+		return false;
+	}	
+	return true;
+}
+
+// visible part of a Width x Height image placed by Context (relative to image)
+static bool NativeClip(struct GDS_Device* Device, JpegCtx *Context, int Width, int Height, int *Left, int *Top, int *Right, int *Bottom) {
+	*Left = Context->XMin > -Context->XOfs ? Context->XMin : -Context->XOfs;
+	*Right = Device->Width - Context->XOfs < Width ? Device->Width - Context->XOfs : Width;
+	*Top = Context->YMin > -Context->YOfs ? Context->YMin : -Context->YOfs;
+	*Bottom = Device->Height - Context->YOfs < Height ? Device->Height - Context->YOfs : Height;
+	
+	// placement's clipping can be negative when centering
+	if (*Left < 0) *Left = 0;
+	if (*Top < 0) *Top = 0;
+	return *Left < *Right && *Top < *Bottom;
+}
+
+/****************************************************************************************
+ *  Draw a native image, placed like JPEG (but never scaled)
+ */
+bool GDS_DrawImage(struct GDS_Device* Device, const uint8_t *Image, int x, int y, int Fit) {
+	NativeImage Native;
+	JpegCtx Context;
+	int Left, Top, Right, Bottom;
+	uint8_t *Buffer = NULL;
+	
+	if (!ParseImage(Image, &Native)) {
+		ESP_LOGE(TAG, "Not a valid native image");
+		return false;
+	}
+	
+	if (!NativeMatch(Device, &Native)) return false;
+	
+	PlaceJPEG(Device, &Context, Native.Width, Native.Height, x, y, Fit & ~GDS_IMAGE_FIT);
+	
+	// nothing visible
+	if (!NativeClip(Device, &Context, Native.Width, Native.Height, &Left, &Top, &Right, &Bottom)) return true;	
+	
+	size_t Size = NativeBufferSize(&Native, Native.Width);
+	if (Size && (Buffer = malloc(Size)) == NULL) {
+		ESP_LOGE(TAG, "Can't allocate row buffer for %d pixels", Native.Width);
+		return false;
+	}	
+	
+	BlitNative(Device, &Native, Context.XOfs, Context.YOfs, Left, Top, Right, Bottom, Buffer);
+	
+	free(Buffer);
+	return true;
+}
+
+/****************************************************************************************
+ *  Animations are sequences of frames made of the rectangles that changed since previous
+ *  frame (see tools/gdsanim.py), each one being rows of native pixels. Only these areas
+ *  are drawn and invalidated, so that drivers able to do it only transmit them. 16 bytes
+ *  header, little endian
+ *	[0..3]	"GDSA"
+ *	[4]		version (1)
+ *	[5]		mode, [6] depth (same as native image, no palette)
+ *	[7]		reserved
+ *	[8..9]	width, [10..11] height, [12..13] frames, [14..15] default frame delay (ms)
+ *  Each frame starts with 4 bytes
+ *	[0..1]	rectangles count, [2..3] delay to next frame (ms, 0 = default)
+ *  followed by rectangles, 16 bytes header then pixels
+ *	[0..7]	x, y, width, height (relative to animation)
+ *	[8]		flags (0x01 = RLE)
+ *	[9..11]	reserved
+ *	[12..15] pixels size in bytes
+ *  First frame is a full one (one rectangle covering animation) so that playback can 
+ *  loop over.
+ */
+#define ANIM_HEADER_SIZE	16
+#define ANIM_FRAME_SIZE		4
+#define ANIM_RECT_SIZE		16
+
+struct GDS_Anim {
+	struct GDS_Device *Device;
+	NativeImage Native;		// animation's format, size, and then current rectangle
+	const uint8_t *Data, *Frame;
+	int Width, Height, Frames, Index, Period;
+	int X, Y, Left, Top, Right, Bottom;		// placement and visible part
+	uint8_t *Buffer;
+};
+
+static inline uint16_t LE16(const uint8_t *p) {
+	return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t LE32(const uint8_t *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+struct GDS_Anim* GDS_AnimCreate(struct GDS_Device* Device, const uint8_t *Data, int x, int y, int Fit) {
+	struct GDS_Anim *Anim;
+	NativeImage Native = { 0 };
+	JpegCtx Context;
+	
+	if (!Data || memcmp(Data, "GDSA", 4) || Data[4] != IMAGE_VERSION) {
+		ESP_LOGE(TAG, "Not a valid animation");
+		return NULL;
+	}
+	
+	// use a fake image header to validate format
+	uint8_t Header[IMAGE_HEADER_SIZE] = { 'G', 'D', 'S', 'I', IMAGE_VERSION, Data[5], Data[6], IMAGE_RLE, Data[8], Data[9], Data[10], Data[11] };
+	if (!ParseImage(Header, &Native) || !NativeMatch(Device, &Native)) return NULL;
+	
+	Anim = calloc(1, sizeof(struct GDS_Anim));
+	if (!Anim || (Anim->Buffer = malloc(NativeBufferSize(&Native, Native.Width))) == NULL) {
+		ESP_LOGE(TAG, "Can't allocate animation for %d pixels", Native.Width);
+		free(Anim);
+		return NULL;
+	}
+	
+	PlaceJPEG(Device, &Context, Native.Width, Native.Height, x, y, Fit & ~GDS_IMAGE_FIT);
+	
+	// an animation entirely out of screen still plays (but does not draw anything)
+	NativeClip(Device, &Context, Native.Width, Native.Height, &Anim->Left, &Anim->Top, &Anim->Right, &Anim->Bottom);
+	Anim->Device = Device;
+	Anim->Native = Native;
+	Anim->Width = Native.Width;
+	Anim->Height = Native.Height;
+	Anim->Data = Anim->Frame = Data + ANIM_HEADER_SIZE;
+	Anim->Frames = LE16(Data + 12);
+	Anim->Period = LE16(Data + 14);
+	Anim->X = Context.XOfs;
+	Anim->Y = Context.YOfs;
+	
+	return Anim;
+}
+
+/****************************************************************************************
+ *  Draw next frame and invalidate its rectangles (caller updates). Returns delay until 
+ *  next frame or -1 when animation has ended (or is corrupted)
+ */
+int GDS_AnimStep(struct GDS_Anim *Anim, bool Loop) {
+	NativeImage *Native = &Anim->Native;
+	
+	if (Anim->Index == Anim->Frames) {
+		if (!Loop || !Anim->Frames) return -1;
+		Anim->Frame = Anim->Data;
+		Anim->Index = 0;
+	}
+	
+	const uint8_t *p = Anim->Frame;
+	int Count = LE16(p), Delay = LE16(p + 2);
+	
+	for (p += ANIM_FRAME_SIZE; Count--; p += ANIM_RECT_SIZE + LE32(p + 12)) {
+		int x = LE16(p), y = LE16(p + 2);
+		
+		Native->Width = LE16(p + 4);
+		Native->Height = LE16(p + 6);
+		Native->Flags = p[8] & IMAGE_RLE;
+		Native->Data = p + ANIM_RECT_SIZE;
+		
+		if (x + Native->Width > Anim->Width || y + Native->Height > Anim->Height) {
+			ESP_LOGE(TAG, "Corrupted animation frame %d", Anim->Index);
+			Anim->Index = Anim->Frames;
+			return -1;
+		}
+		
+		// clip rectangle to animation's visible part
+		int Left = Anim->Left > x ? Anim->Left - x : 0;
+		int Top = Anim->Top > y ? Anim->Top - y : 0;
+		int Right = Anim->Right - x < Native->Width ? Anim->Right - x : Native->Width;
+		int Bottom = Anim->Bottom - y < Native->Height ? Anim->Bottom - y : Native->Height;
+		
+		if (Left < Right && Top < Bottom) BlitNative(Anim->Device, Native, Anim->X + x, Anim->Y + y, Left, Top, Right, Bottom, Anim->Buffer);
+	}
+	
+	Anim->Frame = p;
+	Anim->Index++;
+	
+	return Delay ? Delay : Anim->Period;
+}
+
+void GDS_AnimDelete(struct GDS_Anim *Anim) {
+	if (!Anim) return;
+	free(Anim->Buffer);
+	free(Anim);
+}
+/****************************************************************************************
+ *  PNG decoding, one row at a time: IDAT are inflated in a 32kB window (ROM's tinfl) and
+ *  each row is unfiltered against the previous one, then drawn. Memory is the inflater,
+ *  its window and two rows, whatever the image size. All color types and bit depths are
+ *  supported, but not interlacing. Pixels with alpha are blended with framebuffer (only
+ *  keyed at 50% on 1 bit displays or when the driver has its own layout), tRNS is used 
+ *  for palette's alpha and as a color key otherwise. CRC are not verified.
+ */
+#define PNG_CHUNK		1024
+
+typedef struct {
+	tinfl_decompressor Inflator;
+	uint8_t Window[TINFL_LZ_DICT_SIZE];
+	// input from memory or stream, Buffer only used with stream
+	const uint8_t *Data;
+	size_t Size, Pos;
+	GDS_ReadFunc *Read;
+	void *Handle;
+	uint8_t Buffer[PNG_CHUNK];
+	// image
+	int Width, Height;
+	uint8_t Depth, Color, Channels, Bpp;
+	int RowBytes;
+	uint8_t Palette[256][4];
+	int Entries;
+	uint16_t Key[3];				// tRNS color key (Keyed true)
+	bool Keyed;
+} PngCtx;
+
+static inline uint32_t BE32(const uint8_t *p) {
+	return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// get a pointer to up to Len bytes of input, returns count (0 at end)
+static size_t PngFetch(PngCtx *Png, const uint8_t **Data, size_t Len) {
+	if (Png->Read) {
+		int Count = Png->Read(Png->Handle, Png->Buffer, Len < PNG_CHUNK ? Len : PNG_CHUNK);
+		*Data = Png->Buffer;
+		return Count > 0 ? Count : 0;
+	}
+	
+	if (Len > Png->Size - Png->Pos) Len = Png->Size - Png->Pos;
+	*Data = Png->Data + Png->Pos;
+	Png->Pos += Len;
+	return Len;
+}
+
+// read exactly Len bytes (or skip them if Dest is NULL)
+static bool PngRead(PngCtx *Png, uint8_t *Dest, size_t Len) {
+	if (!Dest && !Png->Read) {
+		if (Len > Png->Size - Png->Pos) return false;
+		Png->Pos += Len;
+		return true;
+	}
+	
+	while (Len) {
+		const uint8_t *Data;
+		size_t Count = PngFetch(Png, &Data, Len);
+		if (!Count) return false;
+		if (Dest) {
+			memcpy(Dest, Data, Count);
+			Dest += Count;
+		}	
+		Len -= Count;
+	}
+	return true;
+}
+
+// parse up to first IDAT, returns its length (0 if failed)
+static uint32_t PngHeaders(PngCtx *Png) {
+	uint8_t Chunk[13];
+	
+	if (!PngRead(Png, Chunk, 8) || memcmp(Chunk, "\x89PNG\r\n\x1a\n", 8)) return 0;
+	
+	for (bool Header = false; PngRead(Png, Chunk, 8); ) {
+		uint32_t Len = BE32(Chunk);
+		
+		if (!memcmp(Chunk + 4, "IHDR", 4) && Len == 13) {
+			if (!PngRead(Png, Chunk, 13)) return 0;
+			Png->Width = BE32(Chunk);
+			Png->Height = BE32(Chunk + 4);
+			Png->Depth = Chunk[8];
+			Png->Color = Chunk[9];
+			// interlacing and unknown compression/filtering
+			if (Chunk[10] || Chunk[11] || Chunk[12]) return 0;
+			Header = true;
+		} else if (!Header) {
+			return 0;
+		} else if (!memcmp(Chunk + 4, "PLTE", 4) && Len <= 768 && Len % 3 == 0) {
+			Png->Entries = Len / 3;
+			for (int i = 0; i < Png->Entries; i++) {
+				if (!PngRead(Png, Png->Palette[i], 3)) return 0;
+				Png->Palette[i][3] = 0xff;
+			}	
+		} else if (!memcmp(Chunk + 4, "tRNS", 4) && Len <= 256) {
+			uint8_t Trans[256];
+			if (!PngRead(Png, Trans, Len)) return 0;
+			if (Png->Color == 3) {
+				for (int i = 0; i < (int) Len && i < 256; i++) Png->Palette[i][3] = Trans[i];
+			} else if ((Png->Color == 0 && Len == 2) || (Png->Color == 2 && Len == 6)) {
+				for (int i = 0; i < (int) Len / 2; i++) Png->Key[i] = (Trans[i * 2] << 8) | Trans[i * 2 + 1];
+				Png->Keyed = true;
+			}	
+		} else if (!memcmp(Chunk + 4, "IDAT", 4)) {
+			break;
+		} else if (!PngRead(Png, NULL, Len)) {
+			return 0;
+		}
+		
+		// CRC
+		if (!PngRead(Png, NULL, 4)) return 0;
+	}
+	
+	// valid color type & depth combinations
+	switch (Png->Color) {
+	case 0: Png->Channels = 1; if (Png->Depth > 16 || (Png->Depth & (Png->Depth - 1))) return 0; break;
+	case 2: Png->Channels = 3; if (Png->Depth != 8 && Png->Depth != 16) return 0; break;
+	case 3: Png->Channels = 1; if (Png->Depth > 8 || (Png->Depth & (Png->Depth - 1)) || !Png->Entries) return 0; break;
+	case 4: Png->Channels = 2; if (Png->Depth != 8 && Png->Depth != 16) return 0; break;
+	case 6: Png->Channels = 4; if (Png->Depth != 8 && Png->Depth != 16) return 0; break;
+	default: return 0;
+	}	
+	
+	Png->RowBytes = (Png->Width * Png->Channels * Png->Depth + 7) / 8;
+	Png->Bpp = (Png->Channels * Png->Depth + 7) / 8;
+	
+	// we are at IDAT's payload
+	return Png->Width && Png->Height && !memcmp(Chunk + 4, "IDAT", 4) ? BE32(Chunk) : 0;
+}
+
+static inline int Paeth(int a, int b, int c) {
+	int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+	if (pa <= pb && pa <= pc) return a;
+	return pb <= pc ? b : c;
+}
+
+static bool PngUnfilter(PngCtx *Png, uint8_t *Row, const uint8_t *Prev) {
+	int Bpp = Png->Bpp, Len = Png->RowBytes, Filter = *Row++;
+	
+	switch (Filter) {
+	case 0: break;
+	case 1: for (int i = Bpp; i < Len; i++) Row[i] += Row[i - Bpp]; break;
+	case 2: for (int i = 0; i < Len; i++) Row[i] += Prev[i]; break;
+	case 3: 
+		for (int i = 0; i < Len; i++) Row[i] += ((i >= Bpp ? Row[i - Bpp] : 0) + Prev[i]) >> 1;
+		break;
+	case 4:
+		for (int i = 0; i < Bpp; i++) Row[i] += Prev[i];
+		for (int i = Bpp; i < Len; i++) Row[i] += Paeth(Row[i - Bpp], Prev[i], Prev[i - Bpp]);
+		break;
+	default: return false;
+	}
+	return true;
+}
+
+// pixel c of an unfiltered row as 8 bits R, G, B & A
+static inline void GetPngPixel(PngCtx *Png, const uint8_t *Row, int c, uint8_t *RGBA) {
+	int Depth = Png->Depth, Step = Png->Channels * Depth / 8;
+	
+	if (Depth < 8) {
+		int v = (Row[(c * Depth) >> 3] >> (8 - Depth - ((c * Depth) & 0x07))) & ((1 << Depth) - 1);
+		if (Png->Color == 3) {
+			memcpy(RGBA, Png->Palette[v], 4);
+		} else {
+			RGBA[0] = RGBA[1] = RGBA[2] = v * 255 / ((1 << Depth) - 1);
+			RGBA[3] = Png->Keyed && v == Png->Key[0] ? 0 : 0xff;
+		}	
+		return;
+	}
+	
+	Row += c * Step;
+	
+	// 16 bits are reduced to their MSB (but key compares all)
+	switch (Png->Color) {
+	case 0: 
+		RGBA[0] = RGBA[1] = RGBA[2] = *Row;
+		RGBA[3] = Png->Keyed && (Depth == 8 ? *Row : (Row[0] << 8) | Row[1]) == Png->Key[0] ? 0 : 0xff;
+		break;
+	case 2: 
+		for (int i = 0; i < 3; i++) RGBA[i] = Row[i * Depth / 8];
+		if (Depth == 8) RGBA[3] = Png->Keyed && Row[0] == Png->Key[0] && Row[1] == Png->Key[1] && Row[2] == Png->Key[2] ? 0 : 0xff;
+		else RGBA[3] = Png->Keyed && BE32(Row) == (((uint32_t) Png->Key[0] << 16) | Png->Key[1]) && ((Row[4] << 8) | Row[5]) == Png->Key[2] ? 0 : 0xff;
+		break;
+	case 3: memcpy(RGBA, Png->Palette[*Row], 4); break;
+	case 4: RGBA[0] = RGBA[1] = RGBA[2] = *Row; RGBA[3] = Row[Depth / 8]; break;
+	default: for (int i = 0; i < 4; i++) RGBA[i] = Row[i * Depth / 8]; break;
+	}	
+}
+
+// framebuffer pixel as 8 bits channels, in scalers' order (gray displays have all equal)
+static void ReadPixel(struct GDS_Device* Device, int X, int Y, uint8_t *Pixels) {
+	int v = 0;
+	
+	switch (Device->Depth) {
+	case 4: 
+		v = (Device->Framebuffer[(Y * Device->Width + X) >> 1] >> ((X & 0x01) << 2)) & 0x0f;
+		Pixels[0] = Pixels[1] = Pixels[2] = v * 17;
+		return;
+	case 8:
+		v = Device->Framebuffer[Y * Device->Width + X];
+		if (Device->Mode == GDS_GRAYSCALE) Pixels[0] = Pixels[1] = Pixels[2] = v;
+		else Pixels[2] = (v >> 5) * 255 / 7, Pixels[1] = ((v >> 2) & 0x07) * 255 / 7, Pixels[0] = (v & 0x03) * 85;
+		return;
+	case 16:
+		v = __builtin_bswap16(((uint16_t*) Device->Framebuffer)[Y * Device->Width + X]);
+		if (Device->Mode == GDS_RGB444) Pixels[2] = (v >> 8) * 17, Pixels[1] = ((v >> 4) & 0x0f) * 17, Pixels[0] = (v & 0x0f) * 17;
+		else if (Device->Mode == GDS_RGB555) Pixels[2] = (v >> 10) * 255 / 31, Pixels[1] = ((v >> 5) & 0x1f) * 255 / 31, Pixels[0] = (v & 0x1f) * 255 / 31;
+		else Pixels[2] = (v >> 11) * 255 / 31, Pixels[1] = ((v >> 5) & 0x3f) * 255 / 63, Pixels[0] = (v & 0x1f) * 255 / 31;
+		return;
+	default:
+		// framebuffer starts with the top channel
+		for (int i = 0; i < 3; i++) Pixels[i] = Device->Framebuffer[(Y * Device->Width + X) * 3 + 2 - i];
+		if (Device->Mode == GDS_RGB666) for (int i = 0; i < 3; i++) Pixels[i] = Pixels[i] * 255 / 63;
+		return;
+	}	
+}
+
+// 8 bits channels in display's format, through the same scalers as JPEG so that colors match
+static int PackPixel(struct GDS_Device* Device, uint8_t *Pixels) {
+	switch (Device->Mode) {
+	case GDS_MONO: 
+	case GDS_GRAYSCALE: return ScalerGray(Pixels) >> (8 - Device->Depth);
+	case GDS_RGB332: return Scaler332(Pixels);
+	case GDS_RGB444: return Scaler444(Pixels);
+	case GDS_RGB555: return Scaler555(Pixels);
+	case GDS_RGB565: return Scaler565(Pixels);
+	case GDS_RGB666: return Scaler666(Pixels);
+	default: return Scaler888(Pixels);
+	}	
+}
+
+static void PngDrawRow(struct GDS_Device* Device, PngCtx *Png, const uint8_t *Row, int X, int Y, int Left, int Right) {
+	// can't blend on 1 bit or when layout is driver's one
+	bool Blend = Device->Depth > 1 && !Device->DrawPixelFast;
+	
+	for (int c = Left; c < Right; c++) {
+		uint8_t RGBA[4];
+		GetPngPixel(Png, Row, c, RGBA);
+		
+		if (RGBA[3] == 0xff || (!Blend && RGBA[3] & 0x80)) {
+			DrawPixelFast(Device, X + c, Y, PackPixel(Device, RGBA));
+		} else if (RGBA[3] && Blend) {
+			uint8_t Back[3];
+			ReadPixel(Device, X + c, Y, Back);
+			for (int i = 0; i < 3; i++) Back[i] = (RGBA[i] * RGBA[3] + Back[i] * (255 - RGBA[3]) + 127) / 255;
+			DrawPixelFast(Device, X + c, Y, PackPixel(Device, Back));
+		}
+	}	
+}
+
+static bool DrawPNG(struct GDS_Device* Device, PngCtx *Png, int x, int y, int Fit) {
+	uint32_t Remain = PngHeaders(Png);
+	JpegCtx Context;
+	int Left, Top, Right, Bottom;
+	
+	if (!Remain) {
+		ESP_LOGE(TAG, "Not a valid or supported PNG");
+		return false;
+	}
+	
+	PlaceJPEG(Device, &Context, Png->Width, Png->Height, x, y, Fit & ~GDS_IMAGE_FIT);
+	if (!NativeClip(Device, &Context, Png->Width, Png->Height, &Left, &Top, &Right, &Bottom)) return true;	
+	
+	// current and previous rows, each with room for filter byte (previous starts zeroed)
+	uint8_t *Row = calloc(2, Png->RowBytes + 1), *Prev = Row + Png->RowBytes + 1;
+	if (!Row) {
+		ESP_LOGE(TAG, "Can't allocate PNG rows for %d bytes", Png->RowBytes);
+		return false;
+	}	
+	
+	const uint8_t *In = NULL;
+	size_t InLen = 0, Fill = 0, Out = 0;
+	int r = 0, Status = TINFL_STATUS_FAILED;
+	bool More = true;
+	tinfl_init(&Png->Inflator);
+	
+	do {
+		// need more input, from current IDAT or next one (stream's buffer must be consumed first)
+		if (!InLen) {
+			if (!Remain && More) {
+				uint8_t Chunk[8];
+				if (PngRead(Png, NULL, 4) && PngRead(Png, Chunk, 8) && !memcmp(Chunk + 4, "IDAT", 4)) Remain = BE32(Chunk);
+				else More = false;
+			}
+			if (Remain) {
+				InLen = PngFetch(Png, &In, Remain);
+				Remain -= InLen;
+				if (!InLen) break;
+			}	
+		}	
+		
+		size_t Count = InLen, Size = TINFL_LZ_DICT_SIZE - Out;
+		Status = tinfl_decompress(&Png->Inflator, In, &Count, Png->Window, Png->Window + Out, &Size, 
+								  TINFL_FLAG_PARSE_ZLIB_HEADER | (Remain || More ? TINFL_FLAG_HAS_MORE_INPUT : 0));
+		In += Count;
+		InLen -= Count;
+		
+		// rebuild rows from what has been inflated
+		for (const uint8_t *p = Png->Window + Out, *End = p + Size; p < End && r < Bottom; ) {
+			size_t Len = End - p < Png->RowBytes + 1 - Fill ? End - p : Png->RowBytes + 1 - Fill;
+			memcpy(Row + Fill, p, Len);
+			p += Len;
+			if ((Fill += Len) <= Png->RowBytes) continue;
+			
+			if (!PngUnfilter(Png, Row, Prev + 1)) {
+				Status = TINFL_STATUS_FAILED;
+				break;
+			}
+			
+			if (r >= Top) PngDrawRow(Device, Png, Row + 1, Context.XOfs, Context.YOfs + r, Left, Right);
+			
+			uint8_t *Swap = Prev;
+			Prev = Row;
+			Row = Swap;
+			Fill = 0;
+			r++;
+		}	
+		
+		Out = (Out + Size) & (TINFL_LZ_DICT_SIZE - 1);
+	} while (r < Bottom && Status > TINFL_STATUS_DONE);
+	
+	free(Row < Prev ? Row : Prev);
+	
+	if (r < Bottom) {
+		ESP_LOGE(TAG, "PNG decoding failed at row %d (%d)", r, Status);
+		return false;
+	}
+	
+	GDS_Invalidate(Device, Context.XOfs + Left, Context.YOfs + Top, Context.XOfs + Right - 1, Context.YOfs + Bottom - 1);
+	return true;
+}
+
+bool GDS_GetPNGSize(const uint8_t *Source, int *Width, int *Height) {
+	if (!Source || memcmp(Source, "\x89PNG\r\n\x1a\n", 8) || memcmp(Source + 12, "IHDR", 4)) return false;
+	*Width = BE32(Source + 16);
+	*Height = BE32(Source + 20);
+	return true;
+}
+
+bool GDS_DrawPNG(struct GDS_Device* Device, const uint8_t *Source, size_t Size, int x, int y, int Fit) {
+	PngCtx *Png = calloc(1, sizeof(PngCtx));
+	
+	if (!Png) {
+		ESP_LOGE(TAG, "Can't allocate PNG decoder");
+		return false;
+	}
+	
+	Png->Data = Source;
+	Png->Size = Size;
+	
+	bool Ret = DrawPNG(Device, Png, x, y, Fit);
+	free(Png);
+	return Ret;
+}
+
+bool GDS_DrawPNGStream(struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit) {
+	PngCtx *Png = calloc(1, sizeof(PngCtx));
+	
+	if (!Png) {
+		ESP_LOGE(TAG, "Can't allocate PNG decoder");
+		return false;
+	}
+	
+	Png->Read = Read;
+	Png->Handle = Handle;
+	
+	bool Ret = DrawPNG(Device, Png, x, y, Fit);
+	free(Png);
+	return Ret;
+}
+
+/****************************************************************************************
+ *  MJPEG playback from concatenated JPEG frames or an AVI (frames are '##dc' or '##db' 
+ *  chunks, rate is from 'avih'), either in memory or read from a stream. A decoding task
+ *  decodes frame N+1 in a spare bitmap while a display task blits frame N & transmits it.
+ *  A frame that is already late by one period is dropped before being decoded.
+ */
+#define MOVIE_SLOTS		2
+#define MOVIE_CHUNK		4096
+#define MOVIE_PERIOD	40000
+
+typedef struct {
+	const uint8_t *Data;			// whole memory source or stream buffer
+	size_t Size, Pos, Start;		// available bytes, current and first frame positions
+	GDS_ReadFunc *Read;				// streamed source
+	void *Handle;
+	uint8_t *Buffer;
+	size_t Alloc;
+	bool Avi;
+	uint32_t Period;				// from AVI header, in us
+} MovieSource;
+
+struct GDS_Movie {
+	struct GDS_Device *Device;
+	MovieSource Source;
+	int x, y, Fit;
+	bool Loop;
+	uint32_t Period;
+	pthread_t Decoder, Display;
+	pthread_mutex_t Mutex;
+	pthread_cond_t Cond;
+	atomic_bool Stop;
+	bool Ended, Running;
+	struct {
+		uint8_t *Data;
+		size_t Size;
+		JpegCtx Place;
+		int64_t Due;
+	} Slots[MOVIE_SLOTS];
+	int Head, Count;
+	int Shown, Dropped;
+	int64_t Window;
+	int WindowShown;
+	float Fps;
+};
+
+static int64_t Now(void) {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (int64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// make sure Len bytes are available from Pos, false at end of source
+static bool MovieFill(MovieSource *Source, size_t Len) {
+	if (Source->Pos + Len <= Source->Size) return true;
+	if (!Source->Read) return false;
+	
+	// keep unread bytes and leave room for decoder's reading ahead
+	if (Source->Pos) {
+		memmove(Source->Buffer, Source->Buffer + Source->Pos, Source->Size - Source->Pos);
+		Source->Size -= Source->Pos;
+		Source->Pos = 0;
+	}
+	
+	if (Len + MOVIE_CHUNK > Source->Alloc) {
+		uint8_t *Buffer = realloc(Source->Buffer, Len + MOVIE_CHUNK);
+		if (!Buffer) return false;
+		Source->Buffer = Buffer;
+		Source->Alloc = Len + MOVIE_CHUNK;
+	}	
+	Source->Data = Source->Buffer;
+	
+	while (Source->Size < Len) {
+		int Bytes = Source->Read(Source->Handle, Source->Buffer + Source->Size, Source->Alloc - MOVIE_CHUNK / 2 - Source->Size);
+		if (Bytes <= 0) return false;
+		Source->Size += Bytes;
+	}
+	
+	return true;
+}
+
+// next frame (valid until next call), returns its length or 0 at end 
+static size_t MovieNextFrame(MovieSource *Source, const uint8_t **Frame) {
+	if (Source->Avi) {
+		while (MovieFill(Source, 8)) {
+			const uint8_t *Chunk = Source->Data + Source->Pos;
+			size_t Len = LE32(Chunk + 4);
+			
+			// just walk into lists 
+			if (!memcmp(Chunk, "RIFF", 4) || !memcmp(Chunk, "LIST", 4)) {
+				Source->Pos += 12;
+				continue;
+			}
+			
+			if (!MovieFill(Source, 8 + Len)) break;
+			Chunk = Source->Data + Source->Pos;
+			Source->Pos += 8 + Len + (Len & 1);
+			
+			if (!memcmp(Chunk, "avih", 4) && Len >= 4) {
+				Source->Period = LE32(Chunk + 8);
+			} else if (Chunk[2] == 'd' && (Chunk[3] == 'c' || Chunk[3] == 'b') && Len) {
+				*Frame = Chunk + 8;
+				return Len;
+			}	
+		}
+		return 0;
+	}
+	
+	// skip whatever is between frames
+	while (MovieFill(Source, 2) && (Source->Data[Source->Pos] != 0xff || Source->Data[Source->Pos + 1] != 0xd8)) Source->Pos++;
+	
+	for (size_t Need = MOVIE_CHUNK; ; Need += MOVIE_CHUNK) {
+		bool More = MovieFill(Source, Need);
+		size_t Len = Source->Size - Source->Pos > 2 ? JpegLength(Source->Data + Source->Pos, Source->Size - Source->Pos) : 0;
+		if (Len) {
+			*Frame = Source->Data + Source->Pos;
+			Source->Pos += Len;
+			return Len;
+		}	
+		if (!More) return 0;
+	}	
+}
+
+static void *MovieDecoder(void *Arg) {
+	struct GDS_Movie *Movie = (struct GDS_Movie*) Arg;
+	struct GDS_JpegDecoder *Decoder = GDS_JpegDecoderCreate(true);
+	int64_t Start = 0;
+	
+	for (int n = 0, Frames = 0; Decoder && !Movie->Stop; n++) {
+		const uint8_t *Frame;
+		size_t Len = MovieNextFrame(&Movie->Source, &Frame);
+		
+		// only memory can loop
+		if (!Len && Movie->Loop && !Movie->Source.Read && n) {
+			Movie->Source.Pos = Movie->Source.Start;
+			Len = MovieNextFrame(&Movie->Source, &Frame);
+		}	
+		if (!Len) break;
+		if (!n) Movie->Source.Start = Frame - Movie->Source.Data - (Movie->Source.Avi ? 8 : 0);
+		if (!Movie->Period) Movie->Period = Movie->Source.Period ? Movie->Source.Period : MOVIE_PERIOD;
+		
+		// clock starts with the first decoded frame, later ones keep their slot even when dropped
+		int64_t Due = Start ? Start + (int64_t) ++Frames * Movie->Period : 0;
+		
+		// too late, no need to decode it
+		if (Start && Now() > Due + Movie->Period) {
+			pthread_mutex_lock(&Movie->Mutex);
+			Movie->Dropped++;
+			pthread_mutex_unlock(&Movie->Mutex);
+			continue;
+		}
+		
+		// wait for a spare bitmap
+		pthread_mutex_lock(&Movie->Mutex);
+		while (Movie->Count == MOVIE_SLOTS && !Movie->Stop) pthread_cond_wait(&Movie->Cond, &Movie->Mutex);
+		int Slot = (Movie->Head + Movie->Count) % MOVIE_SLOTS;
+		pthread_mutex_unlock(&Movie->Mutex);
+		if (Movie->Stop) break;
+		
+		JpegCtx *Place = &Movie->Slots[Slot].Place;
+		int Width, Height;
+		
+		*Place = (JpegCtx) { .InData = Frame, .InSize = Len, .Abort = &Movie->Stop };
+		if (!ProbeJPEG(Frame, Len, &Width, &Height)) {
+			ESP_LOGW(TAG, "Skipping invalid frame %d", n);
+			continue;
+		}	
+		
+		// in device's format, at final placement's size
+		PlaceJPEG(Movie->Device, Place, Width, Height, Movie->x, Movie->y, Movie->Fit);
+		size_t Size = Place->Width * Place->Height * ModeBytes(Movie->Device->Mode);
+		if (Size > Movie->Slots[Slot].Size) {
+			free(Movie->Slots[Slot].Data);
+			Movie->Slots[Slot].Data = malloc(Size);
+			Movie->Slots[Slot].Size = Movie->Slots[Slot].Data ? Size : 0;
+		}	
+		
+		Place->OutData = Movie->Slots[Slot].Data;
+		Place->Stride = Place->Width;
+		if (!Place->OutData || !DecodeJPEG(Decoder, Place, NULL, NULL, 1, Movie->Device->Mode)) {
+			pthread_mutex_lock(&Movie->Mutex);
+			Movie->Dropped++;
+			pthread_mutex_unlock(&Movie->Mutex);
+			continue;
+		}	
+		
+		// first frame sets the clock
+		if (!Start) Start = Due = Now();
+		
+		pthread_mutex_lock(&Movie->Mutex);
+		Movie->Slots[Slot].Due = Due;
+		Movie->Count++;
+		pthread_cond_broadcast(&Movie->Cond);
+		pthread_mutex_unlock(&Movie->Mutex);
+	}
+	
+	pthread_mutex_lock(&Movie->Mutex);
+	Movie->Ended = true;
+	pthread_cond_broadcast(&Movie->Cond);
+	pthread_mutex_unlock(&Movie->Mutex);
+	
+	GDS_JpegDecoderDelete(Decoder);
+	return NULL;
+}
+
+static void *MovieDisplay(void *Arg) {
+	struct GDS_Movie *Movie = (struct GDS_Movie*) Arg;
+	
+	pthread_mutex_lock(&Movie->Mutex);
+	
+	while (1) {
+		while (!Movie->Count && !Movie->Ended && !Movie->Stop) pthread_cond_wait(&Movie->Cond, &Movie->Mutex);
+		if (Movie->Stop || !Movie->Count) break;
+		pthread_mutex_unlock(&Movie->Mutex);
+		
+		// wait for its time, then draw and transmit while next one is decoded
+		int Slot = Movie->Head;
+		int64_t Wait = Movie->Slots[Slot].Due - Now();
+		if (Wait > 0) usleep(Wait);
+		DrawPlaced(Movie->Device, &Movie->Slots[Slot].Place, Movie->Slots[Slot].Data);
+		GDS_Update(Movie->Device);
+		
+		pthread_mutex_lock(&Movie->Mutex);
+		Movie->Head = (Movie->Head + 1) % MOVIE_SLOTS;
+		Movie->Count--;
+		Movie->Shown++;
+		pthread_cond_broadcast(&Movie->Cond);
+		
+		// achieved rate over (at least) one second
+		int64_t Elapsed = Now() - Movie->Window;
+		if (!Movie->Window) {
+			Movie->Window = Now();
+		} else {
+			Movie->WindowShown++;
+			if (Elapsed >= 1000000) {
+				Movie->Fps = Movie->WindowShown * 1000000.0f / Elapsed;
+				Movie->Window += Elapsed;
+				Movie->WindowShown = 0;
+			}	
+		}	
+	}
+	
+	Movie->Running = false;
+	pthread_mutex_unlock(&Movie->Mutex);
+	return NULL;
+}
+
+static void MovieFree(struct GDS_Movie *Movie) {
+	for (int i = 0; i < MOVIE_SLOTS; i++) free(Movie->Slots[i].Data);
+	pthread_mutex_destroy(&Movie->Mutex);
+	pthread_cond_destroy(&Movie->Cond);
+	free(Movie->Source.Buffer);
+	free(Movie);
+}
+
+static struct GDS_Movie* MoviePlay(struct GDS_Movie *Movie) {
+	MovieSource *Source = &Movie->Source;
+
+	if (MovieFill(Source, 12) && !memcmp(Source->Data + Source->Pos, "RIFF", 4) && !memcmp(Source->Data + Source->Pos + 8, "AVI ", 4)) {
+		Source->Avi = true;
+	} else if (!MovieFill(Source, 2) || Source->Data[Source->Pos] != 0xff || Source->Data[Source->Pos + 1] != 0xd8) {
+		ESP_LOGE(TAG, "Movie is neither AVI nor JPEG frames");
+		free(Source->Buffer);
+		free(Movie);
+		return NULL;
+	}
+	
+	pthread_mutex_init(&Movie->Mutex, NULL);
+	pthread_cond_init(&Movie->Cond, NULL);
+	Movie->Running = true;
+	
+	// decoder on the other core, display can go anywhere
+	bool Started = StartThread(&Movie->Decoder, MovieDecoder, Movie, 1, 5, "gds_movie");
+	
+	if (Started && !StartThread(&Movie->Display, MovieDisplay, Movie, -1, 5, "gds_display")) {
+		Movie->Stop = true;
+		pthread_cond_broadcast(&Movie->Cond);
+		pthread_join(Movie->Decoder, NULL);
+		Started = false;
+	}	
+	
+	if (!Started) {
+		MovieFree(Movie);
+		return NULL;
+	}	
+	
+	return Movie;
+}
+
+struct GDS_Movie* GDS_MoviePlay(struct GDS_Device* Device, const uint8_t *Data, size_t Size, int x, int y, int Fit, float Fps, bool Loop) {
+	struct GDS_Movie *Movie = calloc(1, sizeof(struct GDS_Movie));
+	if (!Movie) return NULL;
+	
+	*Movie = (struct GDS_Movie) { .Device = Device, .x = x, .y = y, .Fit = Fit, .Loop = Loop, 
+								  .Period = Fps > 0 ? 1000000 / Fps : 0, .Source = { .Data = Data, .Size = Size } };
+	return MoviePlay(Movie);
+}
+
+struct GDS_Movie* GDS_MoviePlayStream(struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit, float Fps) {
+	struct GDS_Movie *Movie = calloc(1, sizeof(struct GDS_Movie));
+	if (!Movie) return NULL;
+	
+	*Movie = (struct GDS_Movie) { .Device = Device, .x = x, .y = y, .Fit = Fit, 
+								  .Period = Fps > 0 ? 1000000 / Fps : 0, .Source = { .Read = Read, .Handle = Handle } };
+	return MoviePlay(Movie);
+}
+
+bool GDS_MovieStatus(struct GDS_Movie *Movie, float *Fps, int *Shown, int *Dropped) {
+	pthread_mutex_lock(&Movie->Mutex);
+	if (Fps) *Fps = Movie->Fps;
+	if (Shown) *Shown = Movie->Shown;
+	if (Dropped) *Dropped = Movie->Dropped;
+	bool Running = Movie->Running;
+	pthread_mutex_unlock(&Movie->Mutex);
+	return Running;
+}
+
+void GDS_MovieStop(struct GDS_Movie *Movie) {
+	pthread_mutex_lock(&Movie->Mutex);
+	Movie->Stop = true;
+	pthread_cond_broadcast(&Movie->Cond);
+	pthread_mutex_unlock(&Movie->Mutex);
+	
+	pthread_join(Movie->Decoder, NULL);
+	pthread_join(Movie->Display, NULL);
+	
+	ESP_LOGI(TAG, "Movie stopped, %d frames shown, %d dropped", Movie->Shown, Movie->Dropped);
+	MovieFree(Movie);
+}
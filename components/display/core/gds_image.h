@@ -9,11 +9,15 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 #include "esp_err.h"
 
 // no progressive JPEG handling
 
 struct GDS_Device;
+struct GDS_JpegDecoder;
+struct GDS_Movie;
+struct GDS_Anim;
 
 // Fit options for GDS_DrawJPEG
 #define GDS_IMAGE_LEFT		0x00
@@ -23,10 +27,68 @@ struct GDS_Device;
 #define GDS_IMAGE_BOTTOM	0x08
 #define GDS_IMAGE_CENTER_Y	0x02
 #define GDS_IMAGE_CENTER	(GDS_IMAGE_CENTER_X | GDS_IMAGE_CENTER_Y)
-#define GDS_IMAGE_FIT		0x10	// re-scale by a factor of 2^N (up to 3)
+#define GDS_IMAGE_FIT		0x10	// downscale to fit, keeping aspect ratio
 
-// Width and Height can be NULL if you already know them (actual scaling is closest ^2)
+// Streamed source: fill Data with up to Len bytes (skip them if Data is NULL), return count or <= 0 on error/end
+typedef int GDS_ReadFunc(void *Handle, uint8_t *Data, int Len);
+
+// Width and Height can be NULL if you already know them (Scale is not rounded to ^2, but no upscaling)
 void*	 	GDS_DecodeJPEG(uint8_t *Source, int *Width, int *Height, float Scale, int RGB_Mode);	// can be 8, 16 or 24 bits per pixel in return
-void	 	GDS_GetJPEGSize(uint8_t *Source, int *Width, int *Height);
+// decode in caller's bitmap (Stride in pixels), downscaled to fit in Width x Height that are updated to actual size
+bool		GDS_DecodeJPEGInto(uint8_t *Source, void *Buffer, int Stride, int *Width, int *Height, int RGB_Mode);
+void	 	GDS_GetJPEGSize(uint8_t *Source, int *Width, int *Height);	// only parses headers, no allocation
 bool 		GDS_DrawJPEG( struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit);	
+// same as above but nothing is read beyond Size (e.g. truncated download), persistent store needs it for big JPEG
+bool 		GDS_DrawJPEGSized( struct GDS_Device* Device, uint8_t *Source, size_t Size, int x, int y, int Fit);	
+// same as above but data is pulled from Read as decoding progresses, only a small input window is needed
+void*		GDS_DecodeJPEGStream(GDS_ReadFunc *Read, void *Handle, int *Width, int *Height, float Scale, int RGB_Mode);
+bool 		GDS_DrawJPEGStream( struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit);
+// shows a stretched 1/8 preview first (display is updated) then draws full image (caller updates, as usual)
+bool		GDS_DrawJPEGProgressive( struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit);
+// reusable decoder owning its workspace (in internal RAM if requested), for one task at a time 
+struct GDS_JpegDecoder*	GDS_JpegDecoderCreate(bool Internal);
+void		GDS_JpegDecoderDelete(struct GDS_JpegDecoder *Decoder);
+void*		GDS_JpegDecoderDecode(struct GDS_JpegDecoder *Decoder, uint8_t *Source, int *Width, int *Height, float Scale, int RGB_Mode);
+bool		GDS_JpegDecoderDraw(struct GDS_JpegDecoder *Decoder, struct GDS_Device* Device, uint8_t *Source, int x, int y, int Fit);
+// Decoding in background by a worker task (started on core 1 on first use unless initialized before, Core -1 = any). 
+// Done is called from that task with the image (NULL if failed) that it owns. Source must remain valid until then.
+// Returns a job id or 0 when queue is full. Cancelled jobs (queued or running) will never call Done
+typedef void GDS_DecodeDone(void *Image, int Width, int Height, void *Arg);
+bool		GDS_DecodeJPEGAsyncInit(int Core, int Priority);
+int			GDS_DecodeJPEGAsync(uint8_t *Source, float Scale, int RGB_Mode, GDS_DecodeDone *Done, void *Arg);
+bool		GDS_DecodeJPEGCancel(int Job);
+// cache of decoded images used by GDS_DrawJPEG (not streamed), LRU evicted beyond budget (0 = disabled, default)
+void		GDS_ImageCacheSetBudget(size_t Bytes);
+void		GDS_ImageCacheFlush(void);
+// persistent store of decoded images (data partition, or file on host, of the store size) also used by GDS_DrawJPEG
+bool		GDS_ImageStoreInit(const char *Name);
+void		GDS_ImageStoreErase(void);
+// MJPEG playback (concatenated JPEG frames or AVI) placed like GDS_DrawJPEG. Frame N+1 is decoded while N is drawn 
+// and transmitted, late frames are dropped to hold Fps (0 = AVI's rate or 25). Device is updated by player until 
+// stopped. Memory (e.g. a mapped partition) can loop, stream is read as it plays. Stop also releases an ended movie
+struct GDS_Movie*	GDS_MoviePlay(struct GDS_Device* Device, const uint8_t *Data, size_t Size, int x, int y, int Fit, float Fps, bool Loop);
+struct GDS_Movie*	GDS_MoviePlayStream(struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit, float Fps);
+bool		GDS_MovieStatus(struct GDS_Movie *Movie, float *Fps, int *Shown, int *Dropped);	// false once ended, Fps is achieved one
+void		GDS_MovieStop(struct GDS_Movie *Movie);
+// native images (see tools/gdsimage.py), placed like JPEG but never scaled, copied as-is when display format matches
+bool		GDS_GetImageSize(const uint8_t *Image, int *Width, int *Height);
+bool		GDS_DrawImage( struct GDS_Device* Device, const uint8_t *Image, int x, int y, int Fit);
+// delta frames animation (see tools/gdsanim.py) placed like native images, Data must remain valid. Step draws next
+// frame, invalidates changed areas only (caller updates) and returns delay in ms before next one, -1 when ended
+struct GDS_Anim*	GDS_AnimCreate(struct GDS_Device* Device, const uint8_t *Data, int x, int y, int Fit);
+int			GDS_AnimStep(struct GDS_Anim *Anim, bool Loop);
+void		GDS_AnimDelete(struct GDS_Anim *Anim);
+// PNG (not interlaced) decoded row by row with bounded memory, placed like native images. Alpha is blended with 
+// framebuffer's content (keyed at 50% on 1 bit displays)
+bool		GDS_GetPNGSize(const uint8_t *Source, int *Width, int *Height);
+bool		GDS_DrawPNG( struct GDS_Device* Device, const uint8_t *Source, size_t Size, int x, int y, int Fit);
+bool		GDS_DrawPNGStream( struct GDS_Device* Device, GDS_ReadFunc *Read, void *Handle, int x, int y, int Fit);
+// ordered dithering when drawing JPEG or RGB on 1 and 4 bits grayscale displays (default off)
+void		GDS_ImageSetDither(bool Enable);
+// RGB_Mode can be or'ed with GDS_RGB_SWAPPED when 16/24 bits Image is already in framebuffer's order (big endian / R first)
+#define GDS_RGB_SWAPPED		0x80
 void 		GDS_DrawRGB( struct GDS_Device* Device, uint8_t *Image, int x, int y, int Width, int Height, int RGB_Mode );
+// same but Width x Height Image is scaled to DstWidth x DstHeight (clipped to display)
+#define GDS_SCALE_NEAREST	0
+#define GDS_SCALE_BOX		1	// 2x2 average, smoother when downscaling
+void		GDS_DrawRGBScaled( struct GDS_Device* Device, uint8_t *Image, int Width, int Height, int RGB_Mode, int x, int y, int DstWidth, int DstHeight, int Filter );
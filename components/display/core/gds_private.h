@@ -92,22 +92,43 @@ struct GDS_Device {
     // cooked text mode
 	struct {
 		int16_t Y, Space;
+		uint8_t Scale;
 		const struct GDS_FontDef* Font;
 	} Lines[MAX_LINES];
 	
 	uint16_t Width;
     uint16_t Height;
 	uint8_t Depth, Mode;
+	// 1 bit depth only: 1 byte = 8 pixels of a row (LSB on the left) instead of 8 lines of a column
+	bool RowFraming;
+	// 1 bit depth only: MSB is the first pixel of the byte (top or left) instead of LSB
+	bool MSBFirst;
+	// driver's SetLayout handles Rotate, otherwise it's done by transposing framebuffer
+	bool HWRotate;
 	
 	uint8_t	Alloc;	
 	uint8_t* Framebuffer;
     uint32_t FramebufferSize;
 	bool Dirty;
+	// area changed by GDS_Invalidate (Right/Bottom excluded), whole screen when Dirty. Update
+	// is only called when not empty and it may limit itself to that area
+	struct {
+		int16_t Left, Top, Right, Bottom;
+	} Damage;
+	// software rotation: Framebuffer is drawn with Width and Height swapped and what has 
+	// changed is transposed into the driver's (physical) framebuffer before Update
+	struct {
+		bool Active;
+		uint8_t* Framebuffer;
+		uint32_t FramebufferSize;
+	} Rotation;
 
 	// default fonts when using direct draw	
 	const struct GDS_FontDef* Font;
     bool FontForceProportional;
     bool FontForceMonospace;
+	uint8_t FontScale;
+	int FontBackground;
 
 	// various driver-specific method
 	// must always provide 
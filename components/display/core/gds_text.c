@@ -24,7 +24,9 @@ static char TAG[] = "gds";
 /****************************************************************************************
  *  Set fonts for each line in text mode
  */
-static const struct GDS_FontDef *GuessFont( struct GDS_Device *Device, int FontType) {
+static const struct GDS_FontDef *GuessFont( struct GDS_Device *Device, int FontType, int *Scale) {
+	*Scale = 1;
+	
 	switch(FontType) {
 	case GDS_FONT_LINE_1:	
 		return &Font_line_1;
@@ -43,40 +45,34 @@ static const struct GDS_FontDef *GuessFont( struct GDS_Device *Device, int FontT
 		if (Device->Height == 32) return &Font_Tarable7Seg_16x32;
 		else return &Font_Tarable7Seg_32x64;
 #else
+	// large fonts are small ones scaled up at runtime, saves a lot of flash
 	case GDS_FONT_LARGE:	
+		*Scale = 2;
+		return &Font_droid_sans_fallback_11x13;
 	case GDS_FONT_SEGMENT:			
-		ESP_LOGW(TAG, "large fonts disabled");
-		return &Font_droid_sans_fallback_15x17;
-		break;		
+		if (Device->Height != 32) *Scale = 2;
+		return &Font_Tarable7Seg_16x32;
 #endif	
 	}
 }
 
-
-/****************************************************************************************
- *  Set fonts for each line in text mode
- */
-bool GDS_TextSetFontAuto(struct GDS_Device* Device, int N, int FontType, int Space) {
-	const struct GDS_FontDef *Font = GuessFont( Device, FontType );
-	return GDS_TextSetFont( Device, N, Font, Space );
-}
-
 /****************************************************************************************
- *  Set fonts for each line in text mode
+ *  Set fonts and scale for each line in text mode
  */
-bool GDS_TextSetFont(struct GDS_Device* Device, int N, const struct GDS_FontDef *Font, int Space) {
+static bool SetLineFont(struct GDS_Device* Device, int N, const struct GDS_FontDef *Font, int Scale, int Space) {
 	if (--N >= MAX_LINES) return false;
 
 	Device->Lines[N].Font = Font;
+	Device->Lines[N].Scale = Scale;
 	
 	// re-calculate lines absolute position
 	Device->Lines[N].Space = Space;
 	Device->Lines[0].Y = Device->Lines[0].Space;
-	for (int i = 1; i <= N; i++) Device->Lines[i].Y = Device->Lines[i-1].Y + Device->Lines[i-1].Font->Height + Device->Lines[i].Space;
+	for (int i = 1; i <= N; i++) Device->Lines[i].Y = Device->Lines[i-1].Y + Device->Lines[i-1].Font->Height * Device->Lines[i-1].Scale + Device->Lines[i].Space;
 		
-	ESP_LOGI(TAG, "Adding line %u at %d (height:%u)", N + 1, Device->Lines[N].Y, Device->Lines[N].Font->Height);
+	ESP_LOGI(TAG, "Adding line %u at %d (height:%u)", N + 1, Device->Lines[N].Y, Device->Lines[N].Font->Height * Scale);
 	
-	if (Device->Lines[N].Y + Device->Lines[N].Font->Height > Device->Height) {
+	if (Device->Lines[N].Y + Device->Lines[N].Font->Height * Scale > Device->Height) {
 		ESP_LOGW(TAG, "line does not fit display");
 		return false;
 	}
@@ -84,6 +80,22 @@ bool GDS_TextSetFont(struct GDS_Device* Device, int N, const struct GDS_FontDef
 	return true;
 }
 
+/****************************************************************************************
+ *  Set fonts for each line in text mode
+ */
+bool GDS_TextSetFontAuto(struct GDS_Device* Device, int N, int FontType, int Space) {
+	int Scale;
+	const struct GDS_FontDef *Font = GuessFont( Device, FontType, &Scale );
+	return SetLineFont( Device, N, Font, Scale, Space );
+}
+
+/****************************************************************************************
+ *  Set fonts for each line in text mode
+ */
+bool GDS_TextSetFont(struct GDS_Device* Device, int N, const struct GDS_FontDef *Font, int Space) {
+	return SetLineFont( Device, N, Font, 1, Space );
+}
+
 /****************************************************************************************
  * 
  */
@@ -94,6 +106,7 @@ bool GDS_TextLine(struct GDS_Device* Device, int N, int Pos, int Attr, char *Tex
 	N--;
 	
 	GDS_SetFont( Device, Device->Lines[N].Font );	
+	GDS_FontSetScale( Device, Device->Lines[N].Scale );
 	if (Attr & GDS_TEXT_MONOSPACE) GDS_FontForceMonospace( Device, true );
 	
 	Width = GDS_FontMeasureString( Device, Text );
@@ -104,7 +117,7 @@ bool GDS_TextLine(struct GDS_Device* Device, int N, int Pos, int Attr, char *Tex
 	
 	// erase if requested
 	if (Attr & GDS_TEXT_CLEAR) {
-		int Y_min = max(0, Device->Lines[N].Y), Y_max = max(0, Device->Lines[N].Y + Device->Lines[N].Font->Height);
+		int Y_min = max(0, Device->Lines[N].Y), Y_max = max(0, Device->Lines[N].Y + GDS_FontGetHeight( Device ));
 		for (int c = (Attr & GDS_TEXT_CLEAR_EOL) ? X : 0; c < Device->Width; c++) 
 			for (int y = Y_min; y < Y_max; y++)
 				DrawPixelFast( Device, c, y, GDS_COLOR_BLACK );
@@ -132,6 +145,7 @@ int GDS_TextStretch(struct GDS_Device* Device, int N, char *String, int Max) {
 	
 	// we might already fit
 	GDS_SetFont( Device, Device->Lines[N].Font );	
+	GDS_FontSetScale( Device, Device->Lines[N].Scale );
 	if (GDS_FontMeasureString( Device, String ) <= Device->Width) return 0;
 		
 	// add some space for better visual 
@@ -183,7 +197,9 @@ void GDS_TextPos(struct GDS_Device* Device, int FontType, int Where, int Attr, c
 	
 	ESP_LOGD(TAG, "Displaying %s at %u with attribute %u", Text, Anchor, Attr);
 	
-	GDS_SetFont( Device, GuessFont( Device, FontType ) );	
+	int Scale;
+	GDS_SetFont( Device, GuessFont( Device, FontType, &Scale ) );	
+	GDS_FontSetScale( Device, Scale );
 	GDS_FontDrawAnchoredString( Device, Anchor, Text, GDS_COLOR_WHITE );
 	
 	Device->Dirty = true;
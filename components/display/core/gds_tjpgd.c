@@ -0,0 +1,475 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <string.h>
+#include "esp_attr.h"
+#include "gds_tjpgd.h"
+
+// fractional bits of dequantized coefficients
+#define QB			5
+#define MUL(x,c)	(((x) * (c)) >> 8)
+#define BYTECLIP(v)	((v) < 0 ? 0 : (v) > 255 ? 255 : (v))
+
+static const DRAM_ATTR uint8_t Zigzag[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// AAN IDCT scaling factors (14 bits), folded in quantization tables
+static const DRAM_ATTR uint16_t AANScales[64] = {
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	22725, 31521, 29692, 26722, 22725, 17855, 12299,  6270,
+	21407, 29692, 27969, 25172, 21407, 16819, 11585,  5906,
+	19266, 26722, 25172, 22654, 19266, 15137, 10426,  5315,
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	12873, 17855, 16819, 15137, 12873, 10114,  6967,  3552,
+	 8867, 12299, 11585, 10426,  8867,  6967,  4799,  2446,
+	 4520,  6270,  5906,  5315,  4520,  3552,  2446,  1247
+};
+
+/****************************************************************************************
+ * Memory pool and input
+ */
+static void* Alloc(JDEC *jd, unsigned Size) {
+	Size = (Size + 3) & ~3;
+	if (Size > jd->sz_pool) return NULL;
+	void *p = jd->pool;
+	jd->pool += Size;
+	jd->sz_pool -= Size;
+	return p;
+}
+
+static int IRAM_ATTR GetByte(JDEC *jd) {
+	if (!jd->dctr) {
+		jd->dptr = jd->inbuf;
+		jd->dctr = jd->infunc(jd, jd->inbuf, JD_SZBUF);
+		if (!jd->dctr) return -1;
+	}
+	jd->dctr--;
+	return *jd->dptr++;
+}
+
+// fill bit register up to at least 25 bits, feed 0's once a marker (or end) is reached
+static void IRAM_ATTR Fill(JDEC *jd) {
+	while (jd->wbit <= 24) {
+		int Byte = 0;
+		if (!jd->marker) {
+			Byte = GetByte(jd);
+			if (Byte == 0xff) {
+				int Next = GetByte(jd);
+				if (Next) {
+					jd->marker = Next < 0 ? 0x100 : Next;
+					Byte = 0;
+				}
+			} else if (Byte < 0) {
+				jd->marker = 0x100;
+				Byte = 0;
+			}
+		}
+		jd->wreg |= (uint32_t) Byte << (24 - jd->wbit);
+		jd->wbit += 8;
+	}
+}
+
+static inline int GetBits(JDEC *jd, int n) {
+	if (jd->wbit < n) Fill(jd);
+	int v = jd->wreg >> (32 - n);
+	jd->wreg <<= n;
+	jd->wbit -= n;
+	return v;
+}
+
+static inline int Extend(int v, int n) {
+	return v < (1 << (n - 1)) ? v - (1 << n) + 1 : v;
+}
+
+static int IRAM_ATTR HuffDecode(JDEC *jd, JHUFF *Huff) {
+	if (jd->wbit < 16) Fill(jd);
+
+	unsigned Entry = Huff->Lut[jd->wreg >> 24];
+	if (Entry) {
+		jd->wreg <<= Entry >> 8;
+		jd->wbit -= Entry >> 8;
+		return Entry & 0xff;
+	}
+
+	for (int Len = 9; Len <= 16; Len++) {
+		int32_t Code = jd->wreg >> (32 - Len);
+		if (Code <= Huff->MaxCode[Len]) {
+			jd->wreg <<= Len;
+			jd->wbit -= Len;
+			return Huff->Val[Huff->ValPtr[Len] + Code - Huff->MinCode[Len]];
+		}
+	}
+
+	return -1;
+}
+
+/****************************************************************************************
+ * Markers
+ */
+static JRESULT CreateQT(JDEC *jd, uint8_t *Data, unsigned Len) {
+	while (Len) {
+		int Id = *Data & 0x0f;
+		if (Len < 65 || Id > 3) return JDR_FMT1;
+		if (*Data++ & 0xf0) return JDR_FMT3;
+		if (!jd->qttbl[Id] && (jd->qttbl[Id] = Alloc(jd, 64 * sizeof(int32_t))) == NULL) return JDR_MEM1;
+		for (int i = 0; i < 64; i++) {
+			int z = Zigzag[i];
+			jd->qttbl[Id][z] = ((uint32_t) *Data++ * AANScales[z] + (1 << (13 - QB))) >> (14 - QB);
+		}
+		Len -= 65;
+	}
+	return JDR_OK;
+}
+
+static JRESULT CreateHuff(JDEC *jd, uint8_t *Data, unsigned Len) {
+	while (Len) {
+		if (Len < 17) return JDR_FMT1;
+		int Class = *Data >> 4, Id = *Data++ & 0x0f, Count = 0;
+		if (Class > 1 || Id > 1) return JDR_FMT1;
+		for (int i = 0; i < 16; i++) Count += Data[i];
+		if (Count > 256 || Len < 17 + Count) return JDR_FMT1;
+
+		JHUFF *Huff = jd->huff[Class][Id];
+		if (!Huff && (Huff = jd->huff[Class][Id] = Alloc(jd, JD_SZHUFF)) == NULL) return JDR_MEM1;
+
+		memset(Huff->Lut, 0, sizeof(Huff->Lut));
+		memcpy(Huff->Val, Data + 16, Count);
+
+		// canonical codes, lookup table for short ones
+		uint32_t Code = 0;
+		for (int L = 1, k = 0; L <= 16; L++) {
+			int n = Data[L - 1];
+			Huff->ValPtr[L] = k;
+			Huff->MinCode[L] = Code;
+			Huff->MaxCode[L] = n ? (int32_t) (Code + n - 1) : -1;
+			for (; n; n--, k++, Code++) {
+				if (L > 8) continue;
+				for (int i = Code << (8 - L), j = 1 << (8 - L); j; i++, j--) Huff->Lut[i] = (L << 8) | Huff->Val[k];
+			}
+			if (Code > (1u << L)) return JDR_FMT1;
+			Code <<= 1;
+		}
+
+		Data += 16 + Count;
+		Len -= 17 + Count;
+	}
+	return JDR_OK;
+}
+
+static JRESULT ParseSOF(JDEC *jd, uint8_t *Data, unsigned Len) {
+	if (Len < 6) return JDR_FMT1;
+	if (Data[0] != 8) return JDR_FMT3;
+	jd->height = (Data[1] << 8) | Data[2];
+	jd->width = (Data[3] << 8) | Data[4];
+	jd->ncomp = Data[5];
+	if (!jd->width || !jd->height) return JDR_FMT1;
+	if ((jd->ncomp != 1 && jd->ncomp != 3) || Len < 6 + jd->ncomp * 3u) return JDR_FMT3;
+
+	for (int i = 0; i < jd->ncomp; i++) {
+		uint8_t Sampling = Data[7 + i * 3];
+		jd->qtid[i] = Data[8 + i * 3];
+		if (jd->qtid[i] > 3) return JDR_FMT1;
+		if (i == 0 && jd->ncomp == 3) {
+			jd->msx = Sampling >> 4;
+			jd->msy = Sampling & 0x0f;
+			if (jd->msx < 1 || jd->msx > 2 || jd->msy < 1 || jd->msy > jd->msx) return JDR_FMT3;
+		} else if (i == 0) {
+			// single component is never interleaved, MCU is one block
+			jd->msx = jd->msy = 1;
+		} else if (Sampling != 0x11) {
+			return JDR_FMT3;
+		}
+	}
+	return JDR_OK;
+}
+
+static JRESULT ParseSOS(JDEC *jd, uint8_t *Data, unsigned Len) {
+	if (Len < 1 || Data[0] != jd->ncomp || Len < 4 + jd->ncomp * 2u) return JDR_FMT3;
+	for (int i = 0; i < jd->ncomp; i++) {
+		uint8_t Tables = Data[2 + i * 2];
+		jd->dcid[i] = Tables >> 4;
+		jd->acid[i] = Tables & 0x0f;
+		if (jd->dcid[i] > 1 || jd->acid[i] > 1) return JDR_FMT3;
+		if (!jd->huff[0][jd->dcid[i]] || !jd->huff[1][jd->acid[i]]) return JDR_FMT1;
+		if (!jd->qttbl[jd->qtid[i]]) return JDR_FMT1;
+	}
+	return JDR_OK;
+}
+
+JRESULT jd_prepare(JDEC *jd, unsigned (*infunc)(JDEC*, uint8_t*, unsigned), void *pool, unsigned sz_pool, void *dev) {
+	memset(jd, 0, sizeof(JDEC));
+	jd->pool = pool;
+	jd->sz_pool = sz_pool;
+	jd->infunc = infunc;
+	jd->device = dev;
+
+	uint8_t *Seg = jd->inbuf = Alloc(jd, JD_SZBUF);
+	if (!Seg) return JDR_MEM1;
+
+	// SOI
+	if (infunc(jd, Seg, 2) != 2) return JDR_INP;
+	if (Seg[0] != 0xff || Seg[1] != 0xd8) return JDR_FMT1;
+
+	while (1) {
+		if (infunc(jd, Seg, 4) != 4) return JDR_INP;
+		if (Seg[0] != 0xff) return JDR_FMT1;
+
+		uint8_t Marker = Seg[1];
+		unsigned Len = (Seg[2] << 8) | Seg[3];
+		JRESULT Res = JDR_OK;
+
+		if (Len < 2) return JDR_FMT1;
+		Len -= 2;
+
+		switch (Marker) {
+		case 0xc0:	// SOF0
+		case 0xc1:	// SOF1 (only 8 bits)
+		case 0xc4:	// DHT
+		case 0xdb:	// DQT
+		case 0xdd:	// DRI
+		case 0xda:	// SOS
+			if (Len > JD_SZBUF) return JDR_MEM2;
+			if (infunc(jd, Seg, Len) != Len) return JDR_INP;
+			if (Marker <= 0xc1) Res = ParseSOF(jd, Seg, Len);
+			else if (Marker == 0xc4) Res = CreateHuff(jd, Seg, Len);
+			else if (Marker == 0xdb) Res = CreateQT(jd, Seg, Len);
+			else if (Marker == 0xdd) jd->nrst = Len >= 2 ? (Seg[0] << 8) | Seg[1] : 0;
+			else if (!jd->ncomp) Res = JDR_FMT1;
+			else Res = ParseSOS(jd, Seg, Len);
+			break;
+		case 0xc2: case 0xc3: case 0xc5: case 0xc6: case 0xc7:
+		case 0xc9: case 0xca: case 0xcb: case 0xcd: case 0xce: case 0xcf:
+		case 0xd9:	// EOI
+			return JDR_FMT3;
+		default:
+			if (infunc(jd, NULL, Len) != Len) return JDR_INP;
+			break;
+		}
+
+		if (Res != JDR_OK) return Res;
+		if (Marker != 0xda) continue;
+
+		// working buffers: coefficients, MCU's YCbCr and output
+		unsigned Blocks = jd->msx * jd->msy + (jd->ncomp == 3 ? 2 : 0);
+		jd->blk = Alloc(jd, 64 * sizeof(int32_t));
+		jd->mcubuf = Alloc(jd, Blocks * 64);
+		jd->workbuf = Alloc(jd, jd->msx * jd->msy * 64 * 3);
+		if (!jd->blk || !jd->mcubuf || !jd->workbuf) return JDR_MEM1;
+
+		// entropy coded data starts here
+		jd->dctr = 0;
+		return JDR_OK;
+	}
+}
+
+/****************************************************************************************
+ * Decoding
+ */
+static void IRAM_ATTR IDCT(int32_t *Blk, uint8_t *Out) {
+	int32_t *p = Blk;
+
+	// columns
+	for (int i = 0; i < 8; i++, p++) {
+		if (!(p[8] | p[16] | p[24] | p[32] | p[40] | p[48] | p[56])) {
+			p[8] = p[16] = p[24] = p[32] = p[40] = p[48] = p[56] = p[0];
+			continue;
+		}
+
+		int32_t t0 = p[0], t1 = p[16], t2 = p[32], t3 = p[48];
+		int32_t t10 = t0 + t2, t11 = t0 - t2, t13 = t1 + t3;
+		int32_t t12 = MUL(t1 - t3, 362) - t13;
+		t0 = t10 + t13; t3 = t10 - t13;
+		t1 = t11 + t12; t2 = t11 - t12;
+
+		int32_t z13 = p[40] + p[24], z10 = p[40] - p[24];
+		int32_t z11 = p[8] + p[56], z12 = p[8] - p[56];
+		int32_t t7 = z11 + z13;
+		int32_t z5 = MUL(z10 + z12, 473);
+		int32_t t6 = MUL(z10, -669) + z5 - t7;
+		int32_t t5 = MUL(z11 - z13, 362) - t6;
+		int32_t t4 = MUL(z12, 277) - z5 + t5;
+
+		p[0] = t0 + t7; p[56] = t0 - t7;
+		p[8] = t1 + t6; p[48] = t1 - t6;
+		p[16] = t2 + t5; p[40] = t2 - t5;
+		p[32] = t3 + t4; p[24] = t3 - t4;
+	}
+
+	// rows, level shift and rounding are added to DC
+	p = Blk;
+	for (int i = 0; i < 8; i++, p += 8, Out += 8) {
+		int32_t t0 = p[0] + (128 << (QB + 3)) + (1 << (QB + 2)), t1 = p[2], t2 = p[4], t3 = p[6];
+		int32_t t10 = t0 + t2, t11 = t0 - t2, t13 = t1 + t3;
+		int32_t t12 = MUL(t1 - t3, 362) - t13;
+		t0 = t10 + t13; t3 = t10 - t13;
+		t1 = t11 + t12; t2 = t11 - t12;
+
+		int32_t z13 = p[5] + p[3], z10 = p[5] - p[3];
+		int32_t z11 = p[1] + p[7], z12 = p[1] - p[7];
+		int32_t t7 = z11 + z13;
+		int32_t z5 = MUL(z10 + z12, 473);
+		int32_t t6 = MUL(z10, -669) + z5 - t7;
+		int32_t t5 = MUL(z11 - z13, 362) - t6;
+		int32_t t4 = MUL(z12, 277) - z5 + t5;
+
+		int32_t v;
+		v = (t0 + t7) >> (QB + 3); Out[0] = BYTECLIP(v);
+		v = (t0 - t7) >> (QB + 3); Out[7] = BYTECLIP(v);
+		v = (t1 + t6) >> (QB + 3); Out[1] = BYTECLIP(v);
+		v = (t1 - t6) >> (QB + 3); Out[6] = BYTECLIP(v);
+		v = (t2 + t5) >> (QB + 3); Out[2] = BYTECLIP(v);
+		v = (t2 - t5) >> (QB + 3); Out[5] = BYTECLIP(v);
+		v = (t3 + t4) >> (QB + 3); Out[4] = BYTECLIP(v);
+		v = (t3 - t4) >> (QB + 3); Out[3] = BYTECLIP(v);
+	}
+}
+
+// decode one block of component c into Out (only DC in Out[0] when DCOnly)
+static JRESULT IRAM_ATTR DecodeBlock(JDEC *jd, int c, uint8_t *Out, int DCOnly) {
+	int32_t *Qt = jd->qttbl[jd->qtid[c]], *Blk = jd->blk;
+	JHUFF *AC = jd->huff[1][jd->acid[c]];
+
+	int s = HuffDecode(jd, jd->huff[0][jd->dcid[c]]);
+	if (s < 0) return JDR_FMT1;
+	if (s) jd->dcv[c] += Extend(GetBits(jd, s), s);
+
+	if (DCOnly) {
+		int32_t v = ((jd->dcv[c] * Qt[0] + (1 << (QB + 2))) >> (QB + 3)) + 128;
+		Out[0] = BYTECLIP(v);
+	} else {
+		memset(Blk, 0, 64 * sizeof(int32_t));
+		Blk[0] = jd->dcv[c] * Qt[0];
+	}
+
+	for (int k = 1; k < 64; k++) {
+		int rs = HuffDecode(jd, AC);
+		if (rs < 0) return JDR_FMT1;
+		s = rs & 0x0f;
+		if (!s) {
+			if (rs != 0xf0) break;
+			k += 15;
+			continue;
+		}
+		k += rs >> 4;
+		if (k > 63) return JDR_FMT1;
+		int v = Extend(GetBits(jd, s), s);
+		if (!DCOnly) {
+			int z = Zigzag[k];
+			Blk[z] = v * Qt[z];
+		}
+	}
+
+	if (!DCOnly) IDCT(Blk, Out);
+	return JDR_OK;
+}
+
+static JRESULT Restart(JDEC *jd, unsigned Count) {
+	int Marker = jd->marker;
+
+	// drop remaining bits and get to next marker
+	jd->wreg = jd->wbit = 0;
+	while (!Marker || Marker == 0xff) {
+		int Byte = GetByte(jd);
+		if (Byte < 0) return JDR_INP;
+		if (Marker == 0xff) Marker = Byte;
+		else if (Byte == 0xff) Marker = Byte;
+	}
+
+	if (Marker != 0xd0 + (Count & 0x07)) return JDR_FMT1;
+
+	jd->marker = 0;
+	memset(jd->dcv, 0, sizeof(jd->dcv));
+	return JDR_OK;
+}
+
+// convert MCU from YCbCr to output format for the visible (scaled) rx * ry area
+static void IRAM_ATTR OutputMCU(JDEC *jd, int rx, int ry) {
+	int Scale = jd->scale, Chroma = jd->msx * jd->msy * 64;
+	// like the ROM, a scaled pixel is the RGB average of its square (DC only at 1/8)
+	int Size = Scale == 3 ? 1 : 1 << Scale, Shift = Scale == 3 ? 0 : Scale * 2;
+	uint8_t *Mcu = jd->mcubuf, *Out8 = jd->workbuf;
+	uint16_t *Out16 = jd->workbuf;
+
+	for (int y = 0; y < ry; y++) {
+		for (int x = 0; x < rx; x++) {
+			int R = 0, G = 0, B = 0;
+
+			for (int sy = 0; sy < Size; sy++) {
+				int py = (y << Scale) + sy, cy = Scale == 3 ? 0 : (py >> (jd->msy - 1)) * 8;
+				uint8_t *Y = Mcu + (py >> 3) * jd->msx * 64 + (py & 7) * 8;
+
+				for (int sx = 0; sx < Size; sx++) {
+					int px = (x << Scale) + sx, Lum = Y[(px >> 3) * 64 + (px & 7)];
+					int r = Lum, g = Lum, b = Lum;
+
+					if (jd->ncomp == 3) {
+						int c = cy + (Scale == 3 ? 0 : px >> (jd->msx - 1));
+						int Cb = Mcu[Chroma + c] - 128, Cr = Mcu[Chroma + 64 + c] - 128;
+						r += (91881 * Cr) >> 16;
+						g -= (22554 * Cb + 46802 * Cr) >> 16;
+						b += (116130 * Cb) >> 16;
+						r = BYTECLIP(r); g = BYTECLIP(g); b = BYTECLIP(b);
+					}
+
+					R += r; G += g; B += b;
+				}
+			}
+
+			R >>= Shift; G >>= Shift; B >>= Shift;
+
+			// same packing as gds_image's Scaler565 and ScalerGray applied to ROM's output
+			if (jd->format == JD_FMT_RGB565) {
+				*Out16++ = ((B & ~0x07) << 8) | ((G & ~0x03) << 3) | (R >> 3);
+			} else if (jd->format == JD_FMT_GRAY) {
+				*Out8++ = (B * 14 + G * 76 + R * 38) >> 7;
+			} else {
+				*Out8++ = R; *Out8++ = G; *Out8++ = B;
+			}
+		}
+	}
+}
+
+JRESULT jd_decomp(JDEC *jd, unsigned (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale) {
+	int mx = jd->msx * 8, my = jd->msy * 8, Luma = jd->msx * jd->msy;
+	unsigned Count = 0;
+
+	if (scale > 3) return JDR_PAR;
+	jd->scale = scale;
+	memset(jd->dcv, 0, sizeof(jd->dcv));
+
+	for (int y = 0; y < jd->height; y += my) {
+		for (int x = 0; x < jd->width; x += mx) {
+			JRESULT Res;
+
+			if (jd->nrst && Count && !(Count % jd->nrst) && (Res = Restart(jd, Count / jd->nrst - 1)) != JDR_OK) return Res;
+			Count++;
+
+			for (int i = 0; i < Luma; i++) {
+				if ((Res = DecodeBlock(jd, 0, jd->mcubuf + i * 64, scale == 3)) != JDR_OK) return Res;
+			}
+			for (int c = 1; c < jd->ncomp; c++) {
+				if ((Res = DecodeBlock(jd, c, jd->mcubuf + (Luma + c - 1) * 64, scale == 3)) != JDR_OK) return Res;
+			}
+
+			// clip to image and scale, skip MCU when nothing is left
+			int rx = (x + mx <= jd->width ? mx : jd->width - x) >> scale;
+			int ry = (y + my <= jd->height ? my : jd->height - y) >> scale;
+			if (!rx || !ry) continue;
+
+			JRECT Rect = { x >> scale, (x >> scale) + rx - 1, y >> scale, (y >> scale) + ry - 1 };
+			OutputMCU(jd, rx, ry);
+			if (!outfunc(jd, jd->workbuf, &Rect)) return JDR_INTR;
+		}
+	}
+
+	return jd->marker == 0x100 ? JDR_INP : JDR_OK;
+}
@@ -0,0 +1,98 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ Baseline JPEG decoder, source compatible with the ROM's TJpgDec (jd_prepare/jd_decomp,
+ JDEC, JRECT and JRESULT) so that gds_image.c can use either of them (symbols are renamed
+ so that they never collide with ROM's ones). On top of that:
+  - MCU can be output as RGB888 (same as ROM), RGB565 words or 8 bits grayscale (set
+    JDEC.format after jd_prepare). RGB565 and grayscale are packed the way gds_image's
+    scalers pack the RGB888 output. At 1/2 and 1/4, pixels are the average of their
+    square as with the ROM, but YCbCr conversion is not bit-exact with it
+  - input buffer size is set by JD_SZBUF (bigger = less input callbacks)
+  - Huffman decoding uses lookup tables, all tables live in the pool so giving it an
+    internal RAM pool keeps the hot data out of PSRAM
+ Only baseline (no progressive, no arithmetic coding), 1 or 3 components and 1x1, 2x1
+ or 2x2 luma sampling are supported.
+*/
+
+#ifndef JD_SZBUF
+#define JD_SZBUF		2048
+#endif
+
+#define jd_prepare		gds_jd_prepare
+#define jd_decomp		gds_jd_decomp
+
+#define JD_FMT_RGB888	0
+#define JD_FMT_RGB565	1
+#define JD_FMT_GRAY		2
+
+typedef enum {
+	JDR_OK = 0,	// succeeded
+	JDR_INTR,	// interrupted by output function
+	JDR_INP,	// device error or wrong termination of input stream
+	JDR_MEM1,	// insufficient memory pool for the image
+	JDR_MEM2,	// insufficient stream input buffer
+	JDR_PAR,	// parameter error
+	JDR_FMT1,	// data format error (may be damaged data)
+	JDR_FMT2,	// right format but not supported
+	JDR_FMT3	// not supported JPEG standard
+} JRESULT;
+
+typedef struct {
+	uint16_t left, right, top, bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+
+typedef struct {
+	uint16_t Lut[256];			// (length << 8) | symbol for codes up to 8 bits
+	int32_t MaxCode[17];		// largest code for each length, -1 if none
+	uint16_t MinCode[17];
+	uint8_t ValPtr[17];
+	uint8_t Val[];
+} JHUFF;
+
+// Huffman tables are allocated once with room for 256 symbols, redefinitions reuse them
+#define JD_SZHUFF		(sizeof(JHUFF) + 256)
+
+// pool that any baseline image fits in: input buffer, 4 quantization and 4 Huffman tables, 
+// coefficients block, 4:2:0 MCU and its RGB888 output
+#define JD_SZPOOL		(JD_SZBUF + 4 * 64 * 4 + 4 * JD_SZHUFF + 64 * 4 + 6 * 64 + 4 * 64 * 3)
+
+struct JDEC {
+	// public
+	uint16_t width, height;		// size of the input image (pixels)
+	uint8_t scale;				// output scaling ratio (1 / 2^scale)
+	uint8_t format;				// output format JD_FMT_xxx (RGB888 by default)
+	void *device;				// user data
+	// private
+	uint8_t ncomp, msx, msy;
+	uint8_t qtid[3], dcid[3], acid[3];
+	int16_t dcv[3];
+	uint16_t nrst, marker;
+	uint8_t *dptr, *inbuf;
+	unsigned dctr;
+	uint32_t wreg;
+	int wbit;
+	int32_t *qttbl[4];
+	JHUFF *huff[2][2];
+	int32_t *blk;
+	uint8_t *mcubuf;
+	void *workbuf;
+	uint8_t *pool;
+	unsigned sz_pool;
+	unsigned (*infunc)(JDEC*, uint8_t*, unsigned);
+};
+
+JRESULT jd_prepare(JDEC *jd, unsigned (*infunc)(JDEC*, uint8_t*, unsigned), void *pool, unsigned sz_pool, void *dev);
+JRESULT jd_decomp(JDEC *jd, unsigned (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale);
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# Generates test JPEG files (needs Pillow). Pixels follow Pattern(), test_tjpgd.c has the same one
+
+import struct
+from io import BytesIO
+from PIL import Image
+
+def Pattern(x, y, Width, Height):
+	return (x * 255 // (Width - 1), y * 255 // (Height - 1), 255 - (x + y) * 255 // (Width + Height - 2))
+
+def Create(Width, Height, Mode = "RGB"):
+	Img = Image.new("RGB", (Width, Height))
+	Img.putdata([Pattern(x, y, Width, Height) for y in range(Height) for x in range(Width)])
+	return Img.convert(Mode)
+
+def Save(Img, Name, **Options):
+	Data = BytesIO()
+	Img.save(Data, "JPEG", quality = 90, **Options)
+	open(Name, "wb").write(Data.getvalue())
+	return Data.getvalue()
+
+# worst case for decoder's pool: 4 quantization tables and 4 Huffman tables of 256 symbols, the 
+# latter being redefined by the actual ones that follow (so image is the same as Source)
+def WorstTables(Source):
+	DQT = b"".join(bytes([Id]) + bytes(range(1, 65)) for Id in (2, 3))
+	Counts = bytes(14) + bytes([128, 128])
+	DHT = b"".join(bytes([Class << 4 | Id]) + Counts + bytes(range(256)) for Class in (0, 1) for Id in (0, 1))
+	Segments = b"".join(struct.pack(">BBH", 0xff, Marker, len(Data) + 2) + Data for Marker, Data in ((0xdb, DQT), (0xc4, DHT)))
+	return Source[:2] + Segments + Source[2:]
+
+Save(Create(120, 88), "444.jpg", subsampling = 0)
+Save(Create(120, 88), "422.jpg", subsampling = 1)
+Source = Save(Create(120, 88), "420.jpg", subsampling = 2)
+Save(Create(120, 88, "L"), "gray.jpg")
+Save(Create(120, 88), "restart.jpg", subsampling = 2, restart_marker_blocks = 3)
+open("tables.jpg", "wb").write(WorstTables(Source))
+Save(Create(768, 768), "large.jpg", subsampling = 2)
@@ -0,0 +1,19 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+#define GPIO_PULLUP_ONLY	0
+#define GPIO_MODE_INPUT		1
+#define GPIO_MODE_OUTPUT	2
+
+int gpio_set_level(int Gpio, int Level); 
+int gpio_get_level(int Gpio);
+int gpio_pad_select_gpio(int Gpio); 
+int gpio_set_pull_mode(int Gpio, int Mode); 
+int gpio_set_direction(int Gpio, int Mode);
@@ -0,0 +1,20 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+typedef struct { int duty_resolution, freq_hz, speed_mode, timer_num; } ledc_timer_config_t;
+typedef struct { int channel, duty, gpio_num, speed_mode, hpoint, timer_sel; } ledc_channel_config_t;
+
+#define LEDC_TIMER_13_BIT		13
+#define LEDC_HIGH_SPEED_MODE	0
+
+int ledc_timer_config(ledc_timer_config_t *Config); 
+int ledc_channel_config(ledc_channel_config_t *Config);
+int ledc_set_duty(int Mode, int Channel, int Duty); 
+int ledc_update_duty(int Mode, int Channel);
@@ -0,0 +1,34 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+// only the tinfl subset of ROM's miniz, implemented over zlib (see host.c)
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TINFL_LZ_DICT_SIZE				32768
+#define TINFL_FLAG_PARSE_ZLIB_HEADER	1
+#define TINFL_FLAG_HAS_MORE_INPUT		2
+
+typedef enum { 
+	TINFL_STATUS_FAILED = -1, TINFL_STATUS_DONE = 0, 
+	TINFL_STATUS_NEEDS_MORE_INPUT = 1, TINFL_STATUS_HAS_MORE_OUTPUT = 2 
+} tinfl_status;
+
+// opaque room for a z_stream, ROM's one is bigger anyway
+typedef struct { 
+	uint32_t m_state; 
+	uint64_t m_stream[32]; 
+} tinfl_decompressor;
+
+#define tinfl_init(r) do { (r)->m_state = 0; } while (0)
+
+tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *pIn_buf_next, size_t *pIn_buf_size, uint8_t *pOut_buf_start, 
+							  uint8_t *pOut_buf_next, size_t *pOut_buf_size, const uint32_t decomp_flags);
@@ -0,0 +1,14 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+// host shims: just enough of ESP-IDF for display core to build and run on a Linux host
+
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
@@ -0,0 +1,14 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+typedef int esp_err_t;
+
+#define ESP_OK		0
+#define ESP_FAIL	-1
@@ -0,0 +1,20 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_INTERNAL	(1 << 0)
+#define MALLOC_CAP_DMA		(1 << 1)
+#define MALLOC_CAP_8BIT		(1 << 2)
+#define MALLOC_CAP_SPIRAM	(1 << 3)
+
+// host has a single heap
+static inline void *heap_caps_malloc(size_t Size, int Caps) { (void) Caps; return malloc(Size); }
+static inline void *heap_caps_calloc(size_t Count, size_t Size, int Caps) { (void) Caps; return calloc(Count, Size); }
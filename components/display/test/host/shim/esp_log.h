@@ -0,0 +1,20 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_err.h"
+
+#define ESP_LOG(l, t, f, ...)	fprintf(stderr, l " (%s) " f "\n", t, ##__VA_ARGS__)
+#define ESP_LOGE(t, f, ...)		ESP_LOG("E", t, f, ##__VA_ARGS__)
+#define ESP_LOGW(t, f, ...)		ESP_LOG("W", t, f, ##__VA_ARGS__)
+#define ESP_LOGI(t, f, ...)		ESP_LOG("I", t, f, ##__VA_ARGS__)
+#define ESP_LOGD(t, f, ...)		do { } while (0)
+#define ESP_LOGV(t, f, ...)		do { } while (0)
@@ -0,0 +1,26 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdarg.h>
+// like IDF's FreeRTOSConfig.h
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+
+typedef int BaseType_t; 
+typedef unsigned UBaseType_t; 
+typedef uint32_t TickType_t;
+
+#define pdMS_TO_TICKS(x)	(x)
+#define portTICK_PERIOD_MS	1
+#define portMAX_DELAY		0xffffffff
+#define pdTRUE				1
+#define pdFALSE				0
+#define pdPASS				1
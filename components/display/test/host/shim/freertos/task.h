@@ -0,0 +1,16 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+void vTaskDelay(TickType_t Ticks);
+TickType_t xTaskGetTickCount(void);
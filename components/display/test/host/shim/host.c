@@ -0,0 +1,79 @@
+/* 
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ * 
+ */
+
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "driver/ledc.h"
+#include "esp32/rom/miniz.h"
+
+_Static_assert(sizeof(z_stream) <= sizeof(((tinfl_decompressor*) 0)->m_stream), "tinfl_decompressor too small");
+
+/****************************************************************************************
+ * no hardware on host
+ */
+int gpio_set_level(int Gpio, int Level) { return 0; }
+int gpio_get_level(int Gpio) { return 0; }
+int gpio_pad_select_gpio(int Gpio) { return 0; }
+int gpio_set_pull_mode(int Gpio, int Mode) { return 0; }
+int gpio_set_direction(int Gpio, int Mode) { return 0; }
+int ledc_timer_config(ledc_timer_config_t *Config) { return 0; }
+int ledc_channel_config(ledc_channel_config_t *Config) { return 0; }
+int ledc_set_duty(int Mode, int Channel, int Duty) { return 0; }
+int ledc_update_duty(int Mode, int Channel) { return 0; }
+
+void vTaskDelay(TickType_t Ticks) {
+	struct timespec Delay = { Ticks / 1000, (Ticks % 1000) * 1000000 };
+	nanosleep(&Delay, NULL);
+}
+
+TickType_t xTaskGetTickCount(void) {
+	struct timespec Now;
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return Now.tv_sec * 1000 + Now.tv_nsec / 1000000;
+}
+
+/****************************************************************************************
+ * tinfl streaming semantic over zlib's inflate (m_state: 0 = new, 1 = running, 2 = done, 3 = failed)
+ */
+tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *pIn_buf_next, size_t *pIn_buf_size, uint8_t *pOut_buf_start, 
+							  uint8_t *pOut_buf_next, size_t *pOut_buf_size, const uint32_t decomp_flags) {
+	z_stream *Stream = (z_stream*) r->m_stream;
+
+	if (!r->m_state) {
+		memset(Stream, 0, sizeof(*Stream));
+		if (inflateInit2(Stream, (decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15) != Z_OK) return TINFL_STATUS_FAILED;
+		r->m_state = 1;
+	}
+
+	if (r->m_state != 1) {
+		*pIn_buf_size = *pOut_buf_size = 0;
+		return r->m_state == 2 ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+	}
+
+	Stream->next_in = (Bytef*) pIn_buf_next; 
+	Stream->avail_in = *pIn_buf_size; 
+	Stream->next_out = pOut_buf_next; 
+	Stream->avail_out = *pOut_buf_size;
+
+	int Status = inflate(Stream, Z_NO_FLUSH);
+
+	*pIn_buf_size -= Stream->avail_in; 
+	*pOut_buf_size -= Stream->avail_out;
+
+	if (Status == Z_STREAM_END || (Status != Z_OK && Status != Z_BUF_ERROR)) {
+		inflateEnd(Stream);
+		r->m_state = Status == Z_STREAM_END ? 2 : 3;
+		return Status == Z_STREAM_END ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+	}
+
+	if (!Stream->avail_out) return TINFL_STATUS_HAS_MORE_OUTPUT;
+	return (decomp_flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
@@ -0,0 +1,47 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+static int Failures;
+
+// logs failed condition but carries on, Report gives the exit code
+#define CHECK(c) do { 													\
+	if (!(c)) {															\
+		fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #c);	\
+		Failures++;														\
+	}																	\
+} while (0)
+
+static inline int Report(const char *Name) {
+	printf("%s: %s\n", Name, Failures ? "FAILED" : "OK");
+	return Failures ? 1 : 0;
+}
+
+// whole file, with some zeroed slack as decoder's input buffer may read beyond JPEG's end
+static inline uint8_t *LoadFile(const char *Name, size_t *Size) {
+	FILE *File = fopen(Name, "rb");
+	uint8_t *Data = NULL;
+	long Len;
+
+	if (!File) return NULL;
+	fseek(File, 0, SEEK_END);
+	Len = ftell(File);
+	rewind(File);
+	if (Len > 0 && (Data = calloc(Len + 4096, 1)) != NULL && fread(Data, 1, Len, File) != (size_t) Len) {
+		free(Data);
+		Data = NULL;
+	}
+	fclose(File);
+	if (Size) *Size = Len;
+	return Data;
+}
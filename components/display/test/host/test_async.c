@@ -0,0 +1,145 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "test.h"
+#include "gds.h"
+#include "gds_image.h"
+
+#define JOBS	64
+
+// what Done has seen for each job, Cancelled is set when GDS_DecodeJPEGCancel said yes
+static struct {
+	int Id, Calls, Width;
+	bool Cancelled;
+} Jobs[JOBS];
+
+static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Cond = PTHREAD_COND_INITIALIZER;
+static bool Gate, Drained;
+static uint8_t *Source;
+
+static void Done(void *Image, int Width, int Height, void *Arg) {
+	int n = (intptr_t) Arg;
+
+	pthread_mutex_lock(&Mutex);
+	Jobs[n].Calls++;
+	Jobs[n].Width = Image ? Width : -1;
+	pthread_mutex_unlock(&Mutex);
+	free(Image);
+}
+
+// holds the worker until Gate is opened
+static void DoneGated(void *Image, int Width, int Height, void *Arg) {
+	Done(Image, Width, Height, Arg);
+	pthread_mutex_lock(&Mutex);
+	while (!Gate) pthread_cond_wait(&Cond, &Mutex);
+	pthread_mutex_unlock(&Mutex);
+}
+
+static void DoneLast(void *Image, int Width, int Height, void *Arg) {
+	Done(Image, Width, Height, Arg);
+	pthread_mutex_lock(&Mutex);
+	Drained = true;
+	pthread_cond_signal(&Cond);
+	pthread_mutex_unlock(&Mutex);
+}
+
+static int Submit(int n, float Scale, GDS_DecodeDone *Callback) {
+	Jobs[n].Id = GDS_DecodeJPEGAsync(Source, Scale, GDS_RGB565, Callback, (void*) (intptr_t) n);
+	return Jobs[n].Id;
+}
+
+static void Cancel(int n) {
+	if (GDS_DecodeJPEGCancel(Jobs[n].Id)) Jobs[n].Cancelled = true;
+}
+
+// jobs are processed in order so once last one is done, all others are
+static void Drain(int n) {
+	Drained = false;
+	while (!Submit(n, 0.125, DoneLast)) usleep(100);
+	pthread_mutex_lock(&Mutex);
+	while (!Drained) pthread_cond_wait(&Cond, &Mutex);
+	pthread_mutex_unlock(&Mutex);
+}
+
+static void OpenGate(void) {
+	pthread_mutex_lock(&Mutex);
+	Gate = true;
+	pthread_cond_broadcast(&Cond);
+	pthread_mutex_unlock(&Mutex);
+}
+
+int main(void) {
+	int Width, Height, n;
+
+	Source = LoadFile("data/large.jpg", NULL);
+	CHECK(Source != NULL);
+	GDS_GetJPEGSize(Source, &Width, &Height);
+
+	// worker is held in job 0's callback, queue fills up
+	CHECK(Submit(0, 0.125, DoneGated) != 0);
+	while (1) {
+		pthread_mutex_lock(&Mutex);
+		bool Called = Jobs[0].Calls;
+		pthread_mutex_unlock(&Mutex);
+		if (Called) break;
+		usleep(1000);
+	}
+	for (n = 1; n <= 4; n++) CHECK(Submit(n, n == 1 ? 1 : 0.125, Done) != 0);
+	CHECK(Submit(5, 0.125, Done) == 0);
+
+	// cancel a queued job (only once), then refill queue
+	Cancel(3);
+	CHECK(Jobs[3].Cancelled);
+	CHECK(!GDS_DecodeJPEGCancel(Jobs[3].Id));
+	CHECK(Submit(6, 0.125, Done) != 0);
+	CHECK(Submit(7, 0.125, Done) == 0);
+
+	// once worker has taken full-scale job 1 there is room for one, then cancel it while it runs
+	OpenGate();
+	while (!Submit(8, 0.125, Done)) usleep(100);
+	Cancel(1);
+	if (!Jobs[1].Cancelled) fprintf(stderr, "job 1 ended before being cancelled, host too fast?\n");
+	Drain(9);
+
+	pthread_mutex_lock(&Mutex);
+	CHECK(Jobs[0].Calls == 1 && Jobs[0].Width == Width / 8);
+	CHECK(Jobs[1].Calls == !Jobs[1].Cancelled);
+	CHECK(Jobs[1].Cancelled || Jobs[1].Width == Width);
+	CHECK(Jobs[2].Calls == 1 && Jobs[2].Width == Width / 8);
+	CHECK(Jobs[3].Calls == 0);
+	CHECK(Jobs[4].Calls == 1 && Jobs[6].Calls == 1 && Jobs[8].Calls == 1);
+	CHECK(Jobs[5].Calls == 0 && Jobs[7].Calls == 0);
+	pthread_mutex_unlock(&Mutex);
+
+	// cancel at random points, Done must never be called for a job whose cancel succeeded
+	for (n = 10; n < JOBS - 1; n++) {
+		while (!Submit(n, (n & 3) ? 0.25 : 1, Done)) usleep(100);
+		if (n & 1) {
+			usleep(rand() % 5000);
+			Cancel(n - (rand() & 1));
+		}
+	}
+	Drain(JOBS - 1);
+
+	pthread_mutex_lock(&Mutex);
+	for (n = 10; n < JOBS; n++) {
+		CHECK(Jobs[n].Calls == (Jobs[n].Cancelled ? 0 : 1));
+		CHECK(Jobs[n].Cancelled || Jobs[n].Width > 0);
+	}
+	pthread_mutex_unlock(&Mutex);
+
+	free(Source);
+	return Report("async");
+}
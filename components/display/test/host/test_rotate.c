@@ -0,0 +1,120 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "gds.h"
+#include "gds_private.h"
+
+static struct {
+	int Depth, Mode, RowFraming, MSBFirst, Width, Height;
+} Configs[] = {
+	{ 1, GDS_MONO, 0, 0, 128, 64 }, { 1, GDS_MONO, 0, 0, 132, 64 }, { 1, GDS_MONO, 0, 1, 250, 128 },
+	{ 1, GDS_MONO, 1, 0, 256, 32 }, { 1, GDS_MONO, 1, 0, 64, 24 }, { 4, GDS_GRAYSCALE, 0, 0, 128, 64 },
+	{ 4, GDS_GRAYSCALE, 0, 0, 256, 64 }, { 8, GDS_RGB332, 0, 0, 100, 60 }, { 16, GDS_RGB565, 0, 0, 160, 128 },
+	{ 16, GDS_RGB565, 0, 0, 37, 21 }, { 24, GDS_RGB666, 0, 0, 90, 70 }, { 24, GDS_RGB888, 0, 0, 33, 47 },
+};
+
+// what driver has been sent (physical framebuffer)
+static uint8_t *Sent;
+
+static void Update(struct GDS_Device *Device) {
+	memcpy(Sent, Device->Framebuffer, Device->FramebufferSize);
+}
+
+// same layouts as drivers
+static void DriverPixel(struct GDS_Device *Device, int X, int Y, int Color) {
+	uint8_t *p, Bit;
+
+	if (Device->RowFraming) {
+		p = Device->Framebuffer + Y * ((Device->Width + 7) / 8) + X / 8;
+		Bit = 1 << (X & 7);
+	} else {
+		p = Device->Framebuffer + (Y / 8) * Device->Width + X;
+		Bit = 1 << (7 - (Y & 7));
+	}
+	*p = Color ? *p | Bit : *p & ~Bit;
+}
+
+static int GetPixel(struct GDS_Device *Device, uint8_t *Buffer, int Width, int x, int y) {
+	int Bytes = Device->Depth / 8, Value = 0;
+
+	if (Device->Depth == 1 && Device->RowFraming) return (Buffer[y * ((Width + 7) / 8) + x / 8] >> (x & 7)) & 1;
+	if (Device->Depth == 1 && Device->MSBFirst) return (Buffer[(y / 8) * Width + x] >> (7 - (y & 7))) & 1;
+	if (Device->Depth == 1) return (Buffer[(y / 8) * Width + x] >> (y & 7)) & 1;
+	if (Device->Depth == 4) return (Buffer[(y * Width + x) / 2] >> ((x & 1) * 4)) & 0x0f;
+	for (int i = 0; i < Bytes; i++) Value = (Value << 8) | Buffer[(y * Width + x) * Bytes + i];
+	return Value;
+}
+
+static void Init(struct GDS_Device *Device, int c) {
+	memset(Device, 0, sizeof(*Device));
+	Device->Width = Configs[c].Width;
+	Device->Height = Configs[c].Height;
+	Device->Depth = Configs[c].Depth;
+	Device->Mode = Configs[c].Mode;
+	Device->RowFraming = Configs[c].RowFraming;
+	Device->MSBFirst = Configs[c].MSBFirst;
+	if (Device->RowFraming || Device->MSBFirst) Device->DrawPixelFast = DriverPixel;
+	if (Device->Depth == 1) Device->FramebufferSize = Device->RowFraming ? (Device->Width + 7) / 8 * Device->Height : Device->Width * ((Device->Height + 7) / 8);
+	else Device->FramebufferSize = (Device->Width * Device->Height * Device->Depth + 7) / 8;
+	Device->Framebuffer = calloc(1, Device->FramebufferSize);
+	Device->Update = Update;
+}
+
+int main(void) {
+	struct GDS_Device Device;
+
+	srand(1);
+
+	// what's sent to driver is the transpose of what's drawn, after partial or full updates
+	for (int c = 0; c < sizeof(Configs) / sizeof(*Configs); c++) {
+		int Width = Configs[c].Width, Height = Configs[c].Height;
+		int Mask = Configs[c].Mode == GDS_RGB666 ? 0x3ffff : (1 << Configs[c].Depth) - 1;
+
+		Init(&Device, c);
+		Sent = calloc(1, Device.FramebufferSize);
+		GDS_SetLayout(&Device, false, false, true);
+		CHECK(Device.Width == Height && Device.Height == Width);
+
+		for (int n = 0; n < 100; n++) {
+			int x1 = rand() % Device.Width, y1 = rand() % Device.Height, x2 = x1 + rand() % 20, y2 = y1 + rand() % 20;
+			for (int y = y1; y <= y2; y++) for (int x = x1; x <= x2; x++) DrawPixel(&Device, x, y, rand() & Mask);
+			if (n % 17 == 0) GDS_SetDirty(&Device);
+			else GDS_Invalidate(&Device, x1, y1, x2, y2);
+			GDS_Update(&Device);
+
+			int Errors = 0;
+			for (int y = 0; y < Device.Height; y++) for (int x = 0; x < Device.Width; x++) {
+				// some MSB first (e-paper) pixels are beyond visible area
+				if (Device.MSBFirst && x >= 122) continue;
+				if (GetPixel(&Device, Device.Framebuffer, Device.Width, x, y) != GetPixel(&Device, Sent, Width, y, x)) Errors++;
+			}
+			CHECK(Errors == 0);
+		}
+
+		GDS_SetLayout(&Device, false, false, false);
+		CHECK(Device.Width == Width && !Device.Rotation.Framebuffer);
+		free(Device.Framebuffer);
+		free(Sent);
+	}
+
+	// 4 bits are transposed by pairs, so odd sizes are refused
+	Configs[0] = (typeof(*Configs)) { 4, GDS_GRAYSCALE, 0, 0, 128, 63 };
+	Configs[1] = (typeof(*Configs)) { 4, GDS_GRAYSCALE, 0, 0, 127, 64 };
+	for (int c = 0; c < 2; c++) {
+		Init(&Device, c);
+		GDS_SetLayout(&Device, false, false, true);
+		CHECK(Device.Width == Configs[c].Width && !Device.Rotation.Active && !Device.Rotation.Framebuffer);
+		free(Device.Framebuffer);
+	}
+
+	return Report("rotate");
+}
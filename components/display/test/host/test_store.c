@@ -0,0 +1,110 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+// store's internals are needed to reboot it, so it is built with gds_image.c
+#include "gds_image.c"
+#include "test.h"
+
+#define STORE_FILE	"test_store.bin"
+#define SECTORS		8
+#define IMAGES		40
+
+// image n has key n and is filled with n, sizes vary so that entries straddle sectors
+static uint32_t ImageSize(int n) {
+	return 1500 + (n * 997) % 5000;
+}
+
+static void Add(int n) {
+	uint8_t *Data = malloc(ImageSize(n));
+	memset(Data, n, ImageSize(n));
+	StoreAdd(n, n, GDS_RGB565, n, n, Data, ImageSize(n), false);
+
+	// wait for writer
+	pthread_mutex_lock(&Store.Mutex);
+	while (Store.Job.Data) pthread_cond_wait(&Store.Cond, &Store.Mutex);
+	pthread_mutex_unlock(&Store.Mutex);
+}
+
+static bool Has(int n) {
+	JpegCtx Context = { .Width = n, .Height = n };
+	const uint8_t *Pixels;
+	bool Found = false;
+
+	pthread_mutex_lock(&Store.Mutex);
+	if ((Pixels = StoreFind(&Context, n, n, GDS_RGB565)) != NULL) {
+		Found = true;
+		for (uint32_t i = 0; i < ImageSize(n); i++) if (Pixels[i] != (uint8_t) n) Found = false;
+	}
+	pthread_mutex_unlock(&Store.Mutex);
+	return Found;
+}
+
+// forget all but the running writer, as if device restarted
+static void Reboot(void) {
+	pthread_mutex_lock(&Store.Mutex);
+	munmap((void*) Store.Data, Store.Size);
+	close(Store.fd);
+	free(Store.Index);
+	Store.Data = NULL;
+	Store.Index = NULL;
+	Store.Count = Store.Max = 0;
+	Store.Head = Store.Sequence = 0;
+	pthread_mutex_unlock(&Store.Mutex);
+	CHECK(GDS_ImageStoreInit(STORE_FILE));
+}
+
+int main(void) {
+	bool Present[IMAGES] = { 0 };
+	uint32_t Head, Sequence;
+	int n;
+
+	FILE *File = fopen(STORE_FILE, "wb");
+	CHECK(File && !ftruncate(fileno(File), SECTORS * STORE_SECTOR));
+	fclose(File);
+	CHECK(GDS_ImageStoreInit(STORE_FILE));
+	GDS_ImageStoreErase();
+
+	// after each wrap, rebooted store must have the same entries and continue at the same place
+	for (n = 1; n < IMAGES; n++) {
+		Add(n);
+		CHECK(Has(n));
+
+		for (int i = 1; i <= n; i++) Present[i] = Has(i);
+		Head = Store.Head;
+		Sequence = Store.Sequence;
+		int Count = Store.Count;
+
+		Reboot();
+		CHECK(Store.Count == Count && Store.Head == Head && Store.Sequence == Sequence);
+		for (int i = 1; i <= n; i++) CHECK(Has(i) == Present[i]);
+	}
+
+	// store has wrapped several times, only oldest entries are gone
+	CHECK(Store.Sequence == IMAGES - 1);
+	for (n = 1; n < IMAGES && !Present[n]; n++);
+	CHECK(n > 1 && Store.Count == IMAGES - n);
+	for (; n < IMAGES; n++) CHECK(Present[n]);
+
+	// interrupted write (pixels but no header) is skipped up to next sector
+	uint8_t Garbage[100];
+	memset(Garbage, 0x55, sizeof(Garbage));
+	Head = Store.Head;
+	CHECK(StoreWrite(Head + sizeof(StoreHeader), Garbage, sizeof(Garbage)));
+	Reboot();
+	CHECK(Store.Head == ((Head + STORE_SECTOR - 1) & ~(STORE_SECTOR - 1)));
+	Add(IMAGES);
+	Reboot();
+	CHECK(Has(IMAGES - 1) && Has(IMAGES));
+
+	GDS_ImageStoreErase();
+	Reboot();
+	CHECK(Store.Count == 0 && Store.Head == 0);
+
+	unlink(STORE_FILE);
+	return Report("store");
+}
@@ -0,0 +1,166 @@
+/*
+ * (c) Philippe G. 2019, philippe_44@outlook.com
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "test.h"
+#include "gds_tjpgd.h"
+
+// size of the images made by data/fixtures.py
+#define WIDTH	120
+#define HEIGHT	88
+
+typedef struct {
+	const uint8_t *Data;
+	size_t Size, Pos;
+	uint8_t *Out;
+	int Width, Bytes;
+} Context;
+
+static unsigned InFunc(JDEC *Decoder, uint8_t *Buf, unsigned Len) {
+	Context *Ctx = Decoder->device;
+	if (Len > Ctx->Size - Ctx->Pos) Len = Ctx->Size - Ctx->Pos;
+	if (Buf) memcpy(Buf, Ctx->Data + Ctx->Pos, Len);
+	Ctx->Pos += Len;
+	return Len;
+}
+
+static unsigned OutFunc(JDEC *Decoder, void *Bitmap, JRECT *Frame) {
+	Context *Ctx = Decoder->device;
+	int Len = (Frame->right - Frame->left + 1) * Ctx->Bytes;
+	for (int y = Frame->top; y <= Frame->bottom; y++, Bitmap = (uint8_t*) Bitmap + Len) {
+		memcpy(Ctx->Out + (y * Ctx->Width + Frame->left) * Ctx->Bytes, Bitmap, Len);
+	}
+	return 1;
+}
+
+// pool is exactly JD_SZPOOL so that sanitizer catches any overrun
+static uint8_t *Decode(const char *Name, int Scale, int Format, JRESULT *Res) {
+	static const int Bytes[] = { [JD_FMT_RGB888] = 3, [JD_FMT_RGB565] = 2, [JD_FMT_GRAY] = 1 };
+	Context Ctx = { .Bytes = Bytes[Format] };
+	void *Pool = malloc(JD_SZPOOL);
+	JDEC Decoder;
+
+	Ctx.Data = LoadFile(Name, &Ctx.Size);
+	if (!Ctx.Data) {
+		fprintf(stderr, "can't load %s\n", Name);
+		*Res = JDR_INP;
+	} else if ((*Res = jd_prepare(&Decoder, InFunc, Pool, JD_SZPOOL, &Ctx)) == JDR_OK) {
+		Ctx.Width = Decoder.width >> Scale;
+		Ctx.Out = calloc(Ctx.Width * (Decoder.height >> Scale), Ctx.Bytes);
+		Decoder.format = Format;
+		*Res = jd_decomp(&Decoder, OutFunc, Scale);
+	}
+
+	free(Pool);
+	free((void*) Ctx.Data);
+	if (*Res == JDR_OK) return Ctx.Out;
+	free(Ctx.Out);
+	return NULL;
+}
+
+// same as fixtures.py, before compression
+static void Pattern(int x, int y, int *RGB) {
+	RGB[0] = x * 255 / (WIDTH - 1);
+	RGB[1] = y * 255 / (HEIGHT - 1);
+	RGB[2] = 255 - (x + y) * 255 / (WIDTH + HEIGHT - 2);
+}
+
+static void CheckFile(const char *Name, bool Gray) {
+	JRESULT Res;
+	uint8_t *Full = Decode(Name, 0, JD_FMT_RGB888, &Res);
+
+	CHECK(Full != NULL);
+	if (!Full) {
+		fprintf(stderr, "%s: decoding failed (%d)\n", Name, Res);
+		return;
+	}
+
+	// close to what was compressed
+	int Error = 0, Max = 0;
+	for (int y = 0; y < HEIGHT; y++) for (int x = 0; x < WIDTH; x++) {
+		uint8_t *p = Full + (y * WIDTH + x) * 3;
+		int RGB[3];
+		Pattern(x, y, RGB);
+		if (Gray) RGB[0] = RGB[1] = RGB[2] = (RGB[0] * 299 + RGB[1] * 587 + RGB[2] * 114 + 500) / 1000;
+		for (int c = 0; c < 3; c++) {
+			int d = abs(p[c] - RGB[c]);
+			Error += d;
+			if (d > Max) Max = d;
+		}
+	}
+	Error /= WIDTH * HEIGHT * 3;
+	CHECK(Error <= 2 && Max <= 24);
+
+	for (int Scale = 0; Scale <= 3; Scale++) {
+		int Width = WIDTH >> Scale, Height = HEIGHT >> Scale, Size = 1 << Scale;
+		uint8_t *RGB = Decode(Name, Scale, JD_FMT_RGB888, &Res);
+		uint16_t *RGB565 = (uint16_t*) Decode(Name, Scale, JD_FMT_RGB565, &Res);
+		uint8_t *Luma = Decode(Name, Scale, JD_FMT_GRAY, &Res);
+
+		CHECK(RGB && RGB565 && Luma);
+		if (!RGB || !RGB565 || !Luma) continue;
+
+		Error = Max = 0;
+		for (int y = 0; y < Height; y++) for (int x = 0; x < Width; x++) {
+			uint8_t *p = RGB + (y * Width + x) * 3;
+			int Average[3] = { 0 };
+
+			// packed like Scaler565 and ScalerGray in gds_image.c
+			CHECK(RGB565[y * Width + x] == (((p[2] & ~0x07) << 8) | ((p[1] & ~0x03) << 3) | (p[0] >> 3)));
+			CHECK(Luma[y * Width + x] == ((p[2] * 14 + p[1] * 76 + p[0] * 38) >> 7));
+
+			// scaled pixel is the average of its square
+			for (int sy = 0; sy < Size; sy++) for (int sx = 0; sx < Size; sx++) {
+				for (int c = 0; c < 3; c++) Average[c] += Full[((y * Size + sy) * WIDTH + x * Size + sx) * 3 + c];
+			}
+			for (int c = 0; c < 3; c++) {
+				int d = abs(p[c] - (Average[c] >> (Scale * 2)));
+				Error += d;
+				if (d > Max) Max = d;
+			}
+		}
+
+		// except at 1/8 where only DC is used (and chroma is shared by subsampled pixels)
+		Error /= Width * Height * 3;
+		if (Scale < 3) CHECK(Max == 0);
+		else CHECK(Error <= 8 && Max <= 24);
+
+		free(RGB);
+		free(RGB565);
+		free(Luma);
+	}
+
+	free(Full);
+}
+
+int main(void) {
+	JRESULT Res;
+
+	CheckFile("data/444.jpg", false);
+	CheckFile("data/422.jpg", false);
+	CheckFile("data/420.jpg", false);
+	CheckFile("data/gray.jpg", true);
+	CheckFile("data/restart.jpg", false);
+
+	// largest tables fit in the pool, and redefined ones replace them
+	uint8_t *Tables = Decode("data/tables.jpg", 0, JD_FMT_RGB888, &Res);
+	uint8_t *Plain = Decode("data/420.jpg", 0, JD_FMT_RGB888, &Res);
+	CHECK(Tables != NULL);
+	CHECK(Tables && Plain && !memcmp(Tables, Plain, WIDTH * HEIGHT * 3));
+	free(Tables);
+	free(Plain);
+
+	// not a JPEG
+	CHECK(Decode("data/fixtures.py", 0, JD_FMT_RGB888, &Res) == NULL && Res == JDR_FMT1);
+
+	return Report("tjpgd");
+}
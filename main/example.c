@@ -157,7 +157,7 @@ void app_main()
 	//init_display("SPI,driver=ST7735,width=160,height=128,cs=18,speed=10000000,reset=21,back=4,VFlip,rotate", "Hello SPI");
 	//init_display("SPI,driver=SSD1351,width=128,height=128,cs=18,speed=10000000,reset=21,HFlip,VFlip", "Hello SPI");
 	//init_display("SPI,driver=SSD1322,width=256,height=64,cs=18,speed=10000000,reset=21,VFlip,HFlip", "Hello SPI");
-	//init_display("SPI,driver=SSD1675:ready=26,width=250,height=122,cs=18,speed=1000000,reset=21", "Hello SPI");
+	//init_display("SPI,driver=SSD1675:ready=26:partial=16,width=250,height=122,cs=18,speed=1000000,reset=21", "Hello SPI");
 #endif	
 #endif
 
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# (c) Philippe G. 2020, philippe_44@outlook.com
+#
+# This software is released under the MIT License.
+# https://opensource.org/licenses/MIT
+#
+# Build an animation played by GDS_AnimStep() from a sequence of images or from an animated
+# GIF (needs Pillow), see gds_image.c for the layout. First frame is stored in full, others
+# only hold the rectangles that have changed since the previous one
+
+import argparse
+import struct
+import sys
+
+from gdsimage import MODES, RLE, load, convert, pack, rle
+
+TILE = 16
+
+# returns list of (width, height, pixels, duration in ms or None)
+def frames(names):
+    if len(names) > 1 or open(names[0], 'rb').read(3) != b'GIF':
+        return [load(name) + (None,) for name in names]
+    try:
+        from PIL import Image, ImageSequence
+    except ImportError:
+        sys.exit('%s: Pillow is needed for GIF' % names[0])
+    out = []
+    for frame in ImageSequence.Iterator(Image.open(names[0])):
+        image = frame.convert('RGB')
+        out.append((image.width, image.height, list(image.getdata()), frame.info.get('duration')))
+    return out
+
+# tiles that differ, merged horizontally then vertically and shrunk to changed pixels
+def changes(prev, cur, width, height, align):
+    def differ(x1, y1, x2, y2):
+        return any(prev[y * width + x1:y * width + x2] != cur[y * width + x1:y * width + x2] for y in range(y1, y2))
+
+    rects = []
+    for ty in range(0, height, TILE):
+        bottom, x = min(ty + TILE, height), 0
+        while x < width:
+            start = x
+            while x < width and differ(x, ty, min(x + TILE, width), bottom): x += TILE
+            if x == start:
+                x += TILE
+                continue
+            right = min(x, width)
+            above = next((r for r in rects if r[0] == start and r[2] == right and r[3] == ty), None)
+            if above: above[3] = bottom
+            else: rects.append([start, ty, right, bottom])
+
+    out = []
+    for x1, y1, x2, y2 in rects:
+        xs = [x for y in range(y1, y2) for x in range(x1, x2) if prev[y * width + x] != cur[y * width + x]]
+        ys = [y for y in range(y1, y2) if prev[y * width + x1:y * width + x2] != cur[y * width + x1:y * width + x2]]
+        left, right = min(xs) & ~(align - 1), max(xs) + 1
+        out.append((left, min(ys), right - left, max(ys) + 1 - min(ys)))
+    return out
+
+def encode(pixels, width, x, y, w, h, depth, use_rle):
+    rows = []
+    for r in range(y, y + h):
+        row = pixels[r * width + x:r * width + x + w]
+        rows.append([bytes([b]) for b in pack(row, depth)] if depth < 8 else row)
+    raw = b''.join(b''.join(row) for row in rows)
+    if use_rle:
+        packed = b''.join(rle(row) for row in rows)
+        if len(packed) < len(raw): return RLE, packed
+    return 0, raw
+
+def main():
+    parser = argparse.ArgumentParser(description='build a GDS delta frames animation')
+    parser.add_argument('-m', '--mode', choices=MODES.keys(), default='rgb565', help='display mode (default rgb565)')
+    parser.add_argument('-r', '--rle', action='store_true', help='run-length encode rectangles (when smaller)')
+    parser.add_argument('-d', '--delay', type=int, default=100, help='default frame delay in ms (default 100)')
+    parser.add_argument('input', nargs='+', help='images in order or one animated GIF')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    mode, depth = MODES[args.mode]
+    sequence = frames(args.input)
+    width, height = sequence[0][:2]
+    if width > 65535 or height > 65535 or len(sequence) > 65535:
+        sys.exit('animation is too large')
+
+    data, prev, rects = bytearray(), None, 0
+    for n, (w, h, pixels, duration) in enumerate(sequence):
+        if (w, h) != (width, height):
+            sys.exit('frame %u is %ux%u, not %ux%u' % (n, w, h, width, height))
+        pixels = [convert(args.mode, *p) for p in pixels]
+        areas = [(0, 0, width, height)] if prev is None else changes(prev, pixels, width, height, 2 if depth == 4 else 1)
+        delay = duration if duration and duration != args.delay else 0
+        data += struct.pack('<HH', len(areas), delay)
+        for x, y, w, h in areas:
+            flags, block = encode(pixels, width, x, y, w, h, depth, args.rle)
+            data += struct.pack('<HHHHB3xI', x, y, w, h, flags, len(block)) + block
+        rects += len(areas)
+        prev = pixels
+
+    header = b'GDSA' + struct.pack('<BBBBHHHH', 1, mode, depth, 0, width, height, len(sequence), args.delay)
+    open(args.output, 'wb').write(header + data)
+    print('%s: %ux%u %s, %u frames, %u rectangles, %u bytes' % (args.output, width, height, args.mode,
+          len(sequence), rects, len(header) + len(data)))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+#
+# (c) Philippe G. 2020, philippe_44@outlook.com
+#
+# This software is released under the MIT License.
+# https://opensource.org/licenses/MIT
+#
+# Convert a built-in font (components/display/fonts/*.c) into a blob that can be
+# memory-mapped by GDS_FontLoad(), e.g. flashed in a data partition with
+#   parttool.py write_partition --partition-name=<label> --input=<blob>
+# or create a 4 bits antialiased font, either by down-sampling a bigger built-in font or
+# by rendering a TrueType font (needs Pillow). Output is a blob or, when its name ends
+# with .c, a source to be added to components/display/fonts
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+def load(source):
+    text = re.sub(r'//.*', '', open(source).read())
+    data = re.search(r'uint8_t\s+\w+\s*\[\s*\]\s*=\s*\{(.*?)\};', text, re.S)
+    fontdef = re.search(r'struct\s+GDS_FontDef\s+\w+\s*=\s*\{(.*?)\};', text, re.S)
+    if not data or not fontdef:
+        sys.exit('%s: no font found' % source)
+
+    glyphs = bytes(int(b, 0) for b in re.findall(r'0x[0-9a-fA-F]+|\d+', data.group(1)))
+    fields = [f.strip() for f in fontdef.group(1).split(',') if f.strip()]
+
+    def value(field):
+        if field.startswith("'"):
+            return ord(field[1:-1].encode().decode('unicode_escape'))
+        return {'true': 1, 'false': 0}.get(field, None) if not field[0].isdigit() else int(field, 0)
+
+    width, height, start, end, mono = [value(f) for f in fields[1:6]]
+    depth = value(fields[6]) if len(fields) > 6 else 0
+    size = (end - start + 1) * (1 + width * column(height, depth))
+    if len(glyphs) < size:
+        # some built-in fonts do not have all the glyphs they claim
+        end = start + len(glyphs) // (1 + width * column(height, depth)) - 1
+        print('%s: only %u bytes of glyphs, truncating to char %u' % (source, len(glyphs), end))
+        size = (end - start + 1) * (1 + width * column(height, depth))
+
+    return { 'width': width, 'height': height, 'start': start, 'end': end, 'mono': mono,
+             'depth': depth, 'glyphs': glyphs[:size] }
+
+def column(height, depth):
+    return (height + 1) // 2 if depth == 4 else (height + 7) // 8
+
+# alpha (0..15) rows of glyphs to font's 4 bits columns, low nibble first going down
+def pack4(chars, width, height):
+    out = bytearray()
+    for advance, alpha in chars:
+        out.append(advance)
+        for x in range(width):
+            col = [alpha[y][x] if x < len(alpha[y]) else 0 for y in range(height)] + [0]
+            out += bytes(col[y] | (col[y + 1] << 4) for y in range(0, height, 2))
+    return bytes(out)
+
+# each pixel of the new glyph is the coverage of a factor x factor square of the 1 bit one
+def downscale(font, factor):
+    if font['depth'] == 4:
+        sys.exit('font is already antialiased')
+    width, height = font['width'], font['height']
+    col, glyph = column(height, 0), 1 + width * column(height, 0)
+    new_width, new_height = (width + factor - 1) // factor, (height + factor - 1) // factor
+
+    chars = []
+    for n in range(font['end'] - font['start'] + 1):
+        data = font['glyphs'][n * glyph:(n + 1) * glyph]
+        pixel = lambda x, y: x < width and y < height and (data[1 + x * col + y // 8] >> (y & 7)) & 1
+        alpha = [[(sum(pixel(x * factor + i, y * factor + j) for i in range(factor) for j in range(factor)) * 15 +
+                  factor * factor // 2) // (factor * factor) for x in range(new_width)] for y in range(new_height)]
+        chars.append(((data[0] + factor - 1) // factor, alpha))
+
+    return dict(font, width=new_width, height=new_height, depth=4, glyphs=pack4(chars, new_width, new_height))
+
+def render(name, size, start, end, mono):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit('%s: Pillow is needed for TrueType fonts' % name)
+    ttf = ImageFont.truetype(name, size)
+    ascent, descent = ttf.getmetrics()
+    height = ascent + descent
+    advances = [int(round(ttf.getlength(chr(c)))) for c in range(start, end + 1)]
+    width = max(advances)
+
+    chars = []
+    for c, advance in zip(range(start, end + 1), advances):
+        image = Image.new('L', (width, height))
+        ImageDraw.Draw(image).text((0, 0), chr(c), font=ttf, fill=255)
+        pixels = image.tobytes()
+        alpha = [[pixels[y * width + x] >> 4 for x in range(width)] for y in range(height)]
+        chars.append((width if mono else min(advance, width), alpha))
+
+    return { 'width': width, 'height': height, 'start': start, 'end': end, 'mono': mono, 'depth': 4,
+             'glyphs': pack4(chars, width, height) }
+
+def write_bin(font, output):
+    header = b'GDSF' + struct.pack('<BBBBHHHH', 1, font['depth'], font['mono'], 0, font['width'],
+                                   font['height'], font['start'], font['end'])
+    open(output, 'wb').write(header + font['glyphs'])
+    return len(header) + len(font['glyphs'])
+
+def write_c(font, output):
+    name = re.sub(r'^font_', '', os.path.splitext(os.path.basename(output))[0])
+    glyph = 1 + font['width'] * column(font['height'], font['depth'])
+    lines = []
+    for n in range(font['end'] - font['start'] + 1):
+        data = font['glyphs'][n * glyph:(n + 1) * glyph]
+        lines.append('    ' + ', '.join('0x%02X' % b for b in data) + ', // Code for char %u' % (font['start'] + n))
+
+    text = '#include <gds_font.h>\n\n'
+    text += '// %ux%u, 4 bits antialiased, generated by tools/gdsfont.py\n\n' % (font['width'], font['height'])
+    text += 'static const uint8_t %s[ ] = {\n%s\n};\n\n' % (name, '\n'.join(lines))
+    text += 'const struct GDS_FontDef Font_%s = {\n    %s,\n    %u,\n    %u,\n    %u,\n    %u,\n    %s,\n    %u\n};\n' % (
+            name, name, font['width'], font['height'], font['start'], font['end'],
+            'true' if font['mono'] else 'false', font['depth'])
+    open(output, 'w').write(text)
+    print('add "extern const struct GDS_FontDef Font_%s;" to gds_font.h' % name)
+    return len(font['glyphs'])
+
+def main():
+    parser = argparse.ArgumentParser(description='convert or create a GDS font')
+    parser.add_argument('-d', '--downscale', type=int, help='antialiased font from a built-in one, 1/N of its size')
+    parser.add_argument('-s', '--size', type=int, help='antialiased font from a TrueType one, N pixels high')
+    parser.add_argument('-r', '--range', default='32-126', help='chars of a TrueType font (default 32-126)')
+    parser.add_argument('-m', '--mono', action='store_true', help='TrueType font is monospace')
+    parser.add_argument('input', help='built-in font (.c) or TrueType font')
+    parser.add_argument('output', help='blob, or source when ending with .c')
+    args = parser.parse_args()
+
+    if args.size:
+        start, end = (int(v) for v in args.range.split('-'))
+        font = render(args.input, args.size, start, end, args.mono)
+    else:
+        font = load(args.input)
+        if args.downscale and args.downscale > 1:
+            font = downscale(font, args.downscale)
+
+    size = write_c(font, args.output) if args.output.endswith('.c') else write_bin(font, args.output)
+    print('%s: %ux%u%s chars %u..%u, %u bytes' % (args.output, font['width'], font['height'],
+          ' antialiased' if font['depth'] == 4 else '', font['start'], font['end'], size))
+
+if __name__ == '__main__':
+    main()
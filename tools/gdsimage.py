@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# (c) Philippe G. 2020, philippe_44@outlook.com
+#
+# This software is released under the MIT License.
+# https://opensource.org/licenses/MIT
+#
+# Convert an image into the GDS native format drawn by GDS_DrawImage(), see gds_image.c
+# for the layout. The blob can be embedded (COMPONENT_EMBED_FILES) or flashed in a data
+# partition and memory-mapped. PPM/PGM are read directly, other formats need Pillow
+
+import argparse
+import struct
+import sys
+
+MODES = { 'mono': (0, 1), 'gray4': (1, 4), 'gray': (1, 8), 'rgb332': (2, 8), 'rgb444': (3, 16),
+          'rgb555': (4, 16), 'rgb565': (5, 16), 'rgb666': (6, 24), 'rgb888': (7, 24) }
+RLE, PALETTE = 0x01, 0x02
+
+def load(name):
+    data = open(name, 'rb').read()
+    if data[:2] in (b'P5', b'P6'):
+        fields, pos = [], 2
+        while len(fields) < 3:
+            while data[pos:pos + 1].isspace(): pos += 1
+            if data[pos:pos + 1] == b'#':
+                pos = data.index(b'\n', pos)
+                continue
+            end = pos
+            while not data[end:end + 1].isspace(): end += 1
+            fields.append(int(data[pos:end]))
+            pos = end
+        width, height, maxval = fields
+        pixels = data[pos + 1:]
+        if maxval != 255:
+            sys.exit('%s: only 8 bits PNM are supported' % name)
+        if data[:2] == b'P5':
+            return width, height, [(g, g, g) for g in pixels[:width * height]]
+        return width, height, [tuple(pixels[i:i + 3]) for i in range(0, width * height * 3, 3)]
+
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('%s: Pillow is needed for formats other than PPM/PGM' % name)
+    image = Image.open(name).convert('RGB')
+    return image.width, image.height, list(image.getdata())
+
+# returns pixel as bytes (depth >= 8) or as a value to be packed, with the channels in the
+# same order as gds_image.c's scalers so that colors match what GDS_DrawJPEG() draws
+def convert(mode, r, g, b):
+    gray = (r * 38 + g * 76 + b * 14) >> 7
+    if mode == 'mono': return gray >> 7
+    if mode == 'gray4': return gray >> 4
+    if mode == 'gray': return bytes([gray])
+    if mode == 'rgb332': return bytes([(b & 0xe0) | ((g & 0xe0) >> 3) | (r >> 6)])
+    if mode == 'rgb444': return struct.pack('>H', ((b & 0xf0) << 4) | (g & 0xf0) | (r >> 4))
+    if mode == 'rgb555': return struct.pack('>H', ((b & 0xf8) << 7) | ((g & 0xf8) << 2) | (r >> 3))
+    if mode == 'rgb565': return struct.pack('>H', ((b & 0xf8) << 8) | ((g & 0xfc) << 3) | (r >> 3))
+    if mode == 'rgb666': return bytes([b >> 2, g >> 2, r >> 2])
+    return bytes([b, g, r])
+
+def pack(values, depth):
+    per = 8 // depth
+    row = bytearray((len(values) + per - 1) // per)
+    for i, v in enumerate(values):
+        row[i // per] |= v << ((i % per) * depth)
+    return bytes(row)
+
+# runs of (c & 0x7f) + 1 times the same unit if c & 0x80, else c + 1 literal units
+def rle(units):
+    out, i = bytearray(), 0
+    while i < len(units):
+        run = 1
+        while i + run < len(units) and run < 128 and units[i + run] == units[i]: run += 1
+        if run > 1:
+            out += bytes([0x80 | (run - 1)]) + units[i]
+            i += run
+            continue
+        start = i
+        while i < len(units) and i - start < 128 and (i + 1 == len(units) or units[i + 1] != units[i]): i += 1
+        out += bytes([i - start - 1]) + b''.join(units[start:i])
+    return bytes(out)
+
+def main():
+    parser = argparse.ArgumentParser(description='convert an image to GDS native format')
+    parser.add_argument('-m', '--mode', choices=MODES.keys(), default='rgb565', help='display mode (default rgb565)')
+    parser.add_argument('-r', '--rle', action='store_true', help='run-length encode rows')
+    parser.add_argument('-p', '--palette', action='store_true', help='use a palette (8 bits depth and above, up to 256 colors)')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    mode, depth = MODES[args.mode]
+    width, height, pixels = load(args.input)
+    if width > 65535 or height > 65535:
+        sys.exit('%s: image is too large' % args.input)
+    pixels = [convert(args.mode, *p) for p in pixels]
+    flags, palette = 0, []
+
+    if args.palette:
+        if depth < 8:
+            sys.exit('palette needs 8 bits depth or more')
+        palette = sorted(set(pixels))
+        if len(palette) > 256:
+            sys.exit('%s: %u colors, too many for a palette' % (args.input, len(palette)))
+        index = { p: bytes([i]) for i, p in enumerate(palette) }
+        pixels = [index[p] for p in pixels]
+        flags |= PALETTE
+
+    # rows of units: bytes when packed or indexed, pixels otherwise
+    rows = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        if depth < 8:
+            row = [bytes([b]) for b in pack(row, depth)]
+        rows.append(row)
+
+    if args.rle:
+        data = b''.join(rle(row) for row in rows)
+        flags |= RLE
+    else:
+        data = b''.join(b''.join(row) for row in rows)
+
+    header = b'GDSI' + struct.pack('<BBBBHHHH', 1, mode, depth, flags, width, height, len(palette), 0)
+    open(args.output, 'wb').write(header + b''.join(palette) + data)
+    print('%s: %ux%u %s%s%s, %u bytes' % (args.output, width, height, args.mode, ' rle' if args.rle else '',
+          ' palette of %u' % len(palette) if palette else '', len(header) + len(data) + len(b''.join(palette))))
+
+if __name__ == '__main__':
+    main()